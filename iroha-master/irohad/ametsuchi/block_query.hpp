@@ -6,6 +6,8 @@
 #ifndef IROHA_BLOCK_QUERY_HPP
 #define IROHA_BLOCK_QUERY_HPP
 
+#include <functional>
+
 #include <boost/optional.hpp>
 #include "ametsuchi/tx_cache_response.hpp"
 #include "common/result.hpp"
@@ -42,6 +44,39 @@ namespace iroha {
       virtual BlockResult getBlock(
           shared_model::interface::types::HeightType height) = 0;
 
+      /// type of function which is applied to the blocks, returns false to
+      /// stop the iteration
+      using BlockFunctionType = std::function<bool(
+          std::shared_ptr<const shared_model::interface::Block>)>;
+
+      /**
+       * Iterate through the blocks with heights in the given range in
+       * ascending order
+       * @param from - height of the first block
+       * @param to - height of the last block, inclusive
+       * @param function - applied to each block of the range
+       * @return error if some block of the range could not be retrieved
+       */
+      virtual expected::Result<void, GetBlockError> forEachBlock(
+          shared_model::interface::types::HeightType from,
+          shared_model::interface::types::HeightType to,
+          BlockFunctionType function) {
+        for (auto height = from; height <= to; ++height) {
+          auto block_result = getBlock(height);
+          if (auto e = expected::resultToOptionalError(block_result)) {
+            return expected::makeError(std::move(e).value());
+          }
+          if (not function(std::move(
+                  boost::get<expected::Value<
+                      std::unique_ptr<shared_model::interface::Block>>>(
+                      block_result)
+                      .value))) {
+            break;
+          }
+        }
+        return {};
+      }
+
       /**
        * Get height of the top block.
        * @return height
@@ -55,6 +55,25 @@ namespace iroha {
        */
       virtual void forEach(FunctionType function) const = 0;
 
+      /// type of function which is applied to the blocks of a range, returns
+      /// false to stop the iteration
+      using RangeFunctionType = std::function<bool(
+          std::shared_ptr<const shared_model::interface::Block>)>;
+
+      /**
+       * Iterates through the stored blocks with heights in the given range in
+       * ascending order, holding only a bounded number of blocks in memory
+       * @param from - height of the first block
+       * @param to - height of the last block, inclusive
+       * @param function - applied to each block of the range
+       * @return false if some block of the range could not be read or a
+       * block is missing between the stored blocks of the range, true
+       * otherwise
+       */
+      virtual bool forRange(shared_model::interface::types::HeightType from,
+                            shared_model::interface::types::HeightType to,
+                            RangeFunctionType function) const = 0;
+
       virtual ~BlockStorage() = default;
     };
 
@@ -0,0 +1,84 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/account_permission_cache.hpp"
+
+#include <mutex>
+
+#include "common/visitor.hpp"
+#include "interfaces/commands/append_role.hpp"
+#include "interfaces/commands/command_variant.hpp"
+#include "interfaces/commands/create_account.hpp"
+#include "interfaces/commands/detach_role.hpp"
+#include "interfaces/iroha_internal/block.hpp"
+
+using namespace iroha::ametsuchi;
+using shared_model::interface::RolePermissionSet;
+using shared_model::interface::types::AccountIdType;
+
+constexpr size_t AccountPermissionCache::kDefaultMaxSize;
+
+AccountPermissionCache::AccountPermissionCache(size_t max_size)
+    : max_size_(max_size), generation_(0) {}
+
+boost::optional<RolePermissionSet> AccountPermissionCache::get(
+    const AccountIdType &account_id, const LoaderType &load) {
+  uint64_t generation;
+  {
+    std::shared_lock<std::shared_timed_mutex> lock(mutex_);
+    auto it = permissions_.find(account_id);
+    if (it != permissions_.end()) {
+      return it->second;
+    }
+    generation = generation_;
+  }
+
+  auto permissions = load();
+  if (permissions) {
+    std::lock_guard<std::shared_timed_mutex> lock(mutex_);
+    // the loaded value may be outdated if a block was committed meanwhile
+    if (generation == generation_) {
+      if (permissions_.size() >= max_size_) {
+        permissions_.clear();
+      }
+      permissions_.emplace(account_id, *permissions);
+    }
+  }
+  return permissions;
+}
+
+void AccountPermissionCache::invalidate(
+    const shared_model::interface::Block &block) {
+  for (const auto &tx : block.transactions()) {
+    for (const auto &command : tx.commands()) {
+      // roles can not be modified after creation, so only the commands
+      // changing the set of roles of an account affect its permissions
+      iroha::visit_in_place(
+          command.get(),
+          [this](const shared_model::interface::AppendRole &c) {
+            this->invalidate(c.accountId());
+          },
+          [this](const shared_model::interface::DetachRole &c) {
+            this->invalidate(c.accountId());
+          },
+          [this](const shared_model::interface::CreateAccount &c) {
+            this->invalidate(c.accountName() + "@" + c.domainId());
+          },
+          [](const auto &) {});
+    }
+  }
+}
+
+void AccountPermissionCache::invalidateAll() {
+  std::lock_guard<std::shared_timed_mutex> lock(mutex_);
+  permissions_.clear();
+  ++generation_;
+}
+
+void AccountPermissionCache::invalidate(const AccountIdType &account_id) {
+  std::lock_guard<std::shared_timed_mutex> lock(mutex_);
+  permissions_.erase(account_id);
+  ++generation_;
+}
@@ -0,0 +1,85 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_ACCOUNT_PERMISSION_CACHE_HPP
+#define IROHA_ACCOUNT_PERMISSION_CACHE_HPP
+
+#include <functional>
+#include <shared_mutex>
+#include <unordered_map>
+
+#include <boost/optional.hpp>
+#include "interfaces/common_objects/types.hpp"
+#include "interfaces/permissions.hpp"
+
+namespace shared_model {
+  namespace interface {
+    class Block;
+  }  // namespace interface
+}  // namespace shared_model
+
+namespace iroha {
+  namespace ametsuchi {
+
+    /**
+     * Cache of effective role permissions of accounts in the committed WSV.
+     * Entries of accounts which roles are changed by a block have to be
+     * invalidated when that block is committed.
+     */
+    class AccountPermissionCache {
+     public:
+      /// Function which reads permissions of an account from the storage
+      using LoaderType = std::function<
+          boost::optional<shared_model::interface::RolePermissionSet>()>;
+
+      /**
+       * @param max_size - the cache is cleared when it reaches this amount of
+       * accounts
+       */
+      explicit AccountPermissionCache(size_t max_size = kDefaultMaxSize);
+
+      /**
+       * Get permissions of the account, load them in case of cache miss
+       * @param account_id - account to get permissions of
+       * @param load - function to load permissions from the storage
+       * @return permissions of the account, or boost::none if they are not in
+       * cache and could not be loaded
+       */
+      boost::optional<shared_model::interface::RolePermissionSet> get(
+          const shared_model::interface::types::AccountIdType &account_id,
+          const LoaderType &load);
+
+      /**
+       * Remove entries of accounts which permissions are changed by the block
+       * @param block - committed block
+       */
+      void invalidate(const shared_model::interface::Block &block);
+
+      /// Remove all the entries
+      void invalidateAll();
+
+      static constexpr size_t kDefaultMaxSize = 100000;
+
+     private:
+      void invalidate(
+          const shared_model::interface::types::AccountIdType &account_id);
+
+      const size_t max_size_;
+
+      std::unordered_map<shared_model::interface::types::AccountIdType,
+                         shared_model::interface::RolePermissionSet>
+          permissions_;
+
+      /// Incremented on each invalidation so that values loaded before it are
+      /// not put into cache
+      uint64_t generation_;
+
+      mutable std::shared_timed_mutex mutex_;
+    };
+
+  }  // namespace ametsuchi
+}  // namespace iroha
+
+#endif  // IROHA_ACCOUNT_PERMISSION_CACHE_HPP
@@ -0,0 +1,250 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/async_block_storage.hpp"
+
+#include <algorithm>
+#include <limits>
+
+#include "interfaces/iroha_internal/block.hpp"
+#include "logger/logger.hpp"
+
+using namespace iroha::ametsuchi;
+using shared_model::interface::types::HeightType;
+
+namespace {
+  /// Delay before the next attempt to write a block after a failed one
+  const std::chrono::milliseconds kRetryDelay{100};
+}  // namespace
+
+constexpr size_t AsyncBlockStorage::kDefaultMaxPendingBlocks;
+constexpr size_t AsyncBlockStorage::kMaxFailedWrites;
+constexpr size_t AsyncBlockStorage::kReadBatchSize;
+
+AsyncBlockStorage::AsyncBlockStorage(std::unique_ptr<BlockStorage> storage,
+                                     size_t max_pending,
+                                     logger::LoggerPtr log)
+    : storage_(std::move(storage)),
+      max_pending_(std::max<size_t>(max_pending, 1)),
+      log_(std::move(log)),
+      top_height_(storedTopHeight()),
+      size_(storage_->size()),
+      writing_(false),
+      failed_writes_(0),
+      consecutive_failed_writes_(0),
+      stop_(false) {
+  worker_ = std::thread(&AsyncBlockStorage::run, this);
+}
+
+AsyncBlockStorage::~AsyncBlockStorage() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stop_ = true;
+  }
+  inserted_cv_.notify_all();
+  worker_.join();
+}
+
+bool AsyncBlockStorage::insert(
+    std::shared_ptr<const shared_model::interface::Block> block) {
+  std::unique_lock<std::mutex> lock(mutex_);
+  if (writesFailed()) {
+    log_->error("Block {} is not inserted since the writes failed",
+                block->height());
+    return false;
+  }
+  if (top_height_ and block->height() != *top_height_ + 1) {
+    log_->warn(
+        "Only blocks with sequential heights could be inserted. Last block "
+        "height: {}, inserting: {}",
+        *top_height_,
+        block->height());
+    return false;
+  }
+
+  written_cv_.wait(lock, [this] {
+    return pending_.size() < max_pending_ or writesFailed();
+  });
+  if (writesFailed()) {
+    log_->error("Block {} is not inserted since the writes failed",
+                block->height());
+    return false;
+  }
+  top_height_ = block->height();
+  ++size_;
+  pending_.push_back(std::move(block));
+  inserted_cv_.notify_one();
+  return true;
+}
+
+boost::optional<std::shared_ptr<const shared_model::interface::Block>>
+AsyncBlockStorage::fetch(HeightType height) const {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (not pending_.empty()) {
+      // pending blocks have sequential heights
+      auto first = pending_.front()->height();
+      if (height >= first and height - first < pending_.size()) {
+        return pending_[height - first];
+      }
+    }
+  }
+  std::shared_lock<std::shared_timed_mutex> storage_lock(storage_mutex_);
+  return storage_->fetch(height);
+}
+
+size_t AsyncBlockStorage::size() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return size_;
+}
+
+void AsyncBlockStorage::clear() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  written_cv_.wait(lock, [this] { return not writing_; });
+  std::lock_guard<std::shared_timed_mutex> storage_lock(storage_mutex_);
+  pending_.clear();
+  storage_->clear();
+  top_height_ = storedTopHeight();
+  size_ = storage_->size();
+  consecutive_failed_writes_ = 0;
+  written_cv_.notify_all();
+}
+
+void AsyncBlockStorage::forEach(FunctionType function) const {
+  // stored blocks have sequential heights starting from 1
+  if (not forRange(1,
+                   std::numeric_limits<HeightType>::max(),
+                   [&function](auto block) {
+                     function(std::move(block));
+                     return true;
+                   })) {
+    log_->error("Failed to read blocks");
+  }
+}
+
+bool AsyncBlockStorage::forRange(HeightType from,
+                                 HeightType to,
+                                 RangeFunctionType function) const {
+  // blocks are taken from memory if they could be not written yet
+  auto pending = pendingBlocks();
+  auto stored_to =
+      pending.empty() ? to : std::min(to, pending.front()->height() - 1);
+
+  // the storage is locked only to read a batch of blocks, so that the writes
+  // do not wait for the function, which could be slow
+  std::vector<BlockPtr> batch;
+  while (from <= stored_to) {
+    auto batch_to = stored_to - from < kReadBatchSize
+        ? stored_to
+        : from + kReadBatchSize - 1;
+    batch.clear();
+    {
+      std::shared_lock<std::shared_timed_mutex> storage_lock(storage_mutex_);
+      if (not storage_->forRange(from, batch_to, [&batch](auto block) {
+            batch.push_back(std::move(block));
+            return true;
+          })) {
+        return false;
+      }
+    }
+    for (auto &block : batch) {
+      if (not function(std::move(block))) {
+        return true;
+      }
+    }
+    // the range goes beyond the stored blocks
+    if (batch.empty() or batch.back()->height() < batch_to) {
+      break;
+    }
+    from = batch_to + 1;
+  }
+
+  for (const auto &block : pending) {
+    if (block->height() > to) {
+      break;
+    }
+    if (block->height() >= from and not function(block)) {
+      break;
+    }
+  }
+  return true;
+}
+
+bool AsyncBlockStorage::flush() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  auto failed_writes = failed_writes_;
+  written_cv_.wait(lock, [this, failed_writes] {
+    return pending_.empty() or failed_writes_ != failed_writes;
+  });
+  return pending_.empty();
+}
+
+void AsyncBlockStorage::run() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  while (true) {
+    inserted_cv_.wait(lock, [this] {
+      return stop_ or (not pending_.empty() and not writesFailed());
+    });
+    if (stop_ and (pending_.empty() or writesFailed())) {
+      if (not pending_.empty()) {
+        log_->critical("{} committed blocks are not written",
+                       pending_.size());
+      }
+      return;
+    }
+
+    auto block = pending_.front();
+    writing_ = true;
+    lock.unlock();
+    bool written;
+    {
+      std::lock_guard<std::shared_timed_mutex> storage_lock(storage_mutex_);
+      written = storage_->insert(block);
+    }
+    lock.lock();
+    writing_ = false;
+
+    if (written) {
+      pending_.pop_front();
+      consecutive_failed_writes_ = 0;
+    } else {
+      ++failed_writes_;
+      ++consecutive_failed_writes_;
+    }
+    written_cv_.notify_all();
+
+    if (not written) {
+      log_->error("Failed to write block {}", block->height());
+      if (writesFailed()) {
+        log_->critical(
+            "Gave up writing blocks after {} failed attempts, {} committed "
+            "blocks are not written",
+            consecutive_failed_writes_,
+            pending_.size());
+        continue;
+      }
+      inserted_cv_.wait_for(lock, kRetryDelay, [this] { return stop_; });
+    }
+  }
+}
+
+boost::optional<HeightType> AsyncBlockStorage::storedTopHeight() const {
+  // stored blocks have sequential heights starting from 1
+  auto size = storage_->size();
+  if (size == 0) {
+    return boost::none;
+  }
+  return static_cast<HeightType>(size);
+}
+
+bool AsyncBlockStorage::writesFailed() const {
+  return consecutive_failed_writes_ >= kMaxFailedWrites;
+}
+
+std::deque<AsyncBlockStorage::BlockPtr> AsyncBlockStorage::pendingBlocks()
+    const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return pending_;
+}
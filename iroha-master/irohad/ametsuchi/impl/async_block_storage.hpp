@@ -0,0 +1,132 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_ASYNC_BLOCK_STORAGE_HPP
+#define IROHA_ASYNC_BLOCK_STORAGE_HPP
+
+#include "ametsuchi/block_storage.hpp"
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <shared_mutex>
+#include <thread>
+#include <vector>
+
+#include "logger/logger_fwd.hpp"
+
+namespace iroha {
+  namespace ametsuchi {
+
+    /**
+     * Block storage which writes inserted blocks to the underlying storage in
+     * a background thread, so that commit does not wait for the write. Blocks
+     * which are not written yet are served from memory, so readers do not
+     * see the difference. Insert waits when too many blocks are not written.
+     *
+     * Blocks which are not written are lost in case of crash, while WSV
+     * already contains them. WSV is restored from the block storage on start,
+     * and the lost blocks are then downloaded from other peers.
+     *
+     * A write is retried until it fails kMaxFailedWrites times in a row. Then
+     * the storage gives up: the blocks are not written until clear, and
+     * insert and flush return false.
+     *
+     * Functions passed to forEach and forRange are called without the locks,
+     * so a slow reader does not delay the writes.
+     */
+    class AsyncBlockStorage : public BlockStorage {
+     public:
+      /**
+       * @param storage - storage to write blocks to
+       * @param max_pending - number of not written blocks, after which insert
+       * waits for the writes
+       * @param log - logger
+       */
+      AsyncBlockStorage(std::unique_ptr<BlockStorage> storage,
+                        size_t max_pending,
+                        logger::LoggerPtr log);
+
+      /// Writes the remaining blocks and stops the background thread
+      ~AsyncBlockStorage() override;
+
+      bool insert(
+          std::shared_ptr<const shared_model::interface::Block> block) override;
+
+      boost::optional<std::shared_ptr<const shared_model::interface::Block>>
+      fetch(shared_model::interface::types::HeightType height) const override;
+
+      size_t size() const override;
+
+      void clear() override;
+
+      void forEach(FunctionType function) const override;
+
+      bool forRange(shared_model::interface::types::HeightType from,
+                    shared_model::interface::types::HeightType to,
+                    RangeFunctionType function) const override;
+
+      /**
+       * Wait until all the inserted blocks are written, or a write fails
+       * @return true if all the blocks are written
+       */
+      bool flush();
+
+      static constexpr size_t kDefaultMaxPendingBlocks = 16;
+
+      /// Number of failed writes in a row, after which the writes stop
+      static constexpr size_t kMaxFailedWrites = 10;
+
+      /// Number of stored blocks which forRange reads under the lock at once
+      static constexpr size_t kReadBatchSize = 16;
+
+     private:
+      using BlockPtr = std::shared_ptr<const shared_model::interface::Block>;
+
+      /// Body of the background thread
+      void run();
+
+      /// @return copy of not written blocks
+      std::deque<BlockPtr> pendingBlocks() const;
+
+      /// @return height of the last block of the underlying storage
+      boost::optional<shared_model::interface::types::HeightType>
+      storedTopHeight() const;
+
+      /// @return true if the storage gave up writing, requires mutex_
+      bool writesFailed() const;
+
+      std::unique_ptr<BlockStorage> storage_;
+      const size_t max_pending_;
+      logger::LoggerPtr log_;
+
+      /// Not written blocks in ascending order of heights. The first one is
+      /// removed only after it is written
+      std::deque<BlockPtr> pending_;
+
+      /// Height of the last inserted block, if it is known
+      boost::optional<shared_model::interface::types::HeightType> top_height_;
+      size_t size_;
+      bool writing_;
+      size_t failed_writes_;
+      size_t consecutive_failed_writes_;
+      bool stop_;
+
+      mutable std::mutex mutex_;
+      /// Notified when a block is inserted or the thread has to stop
+      std::condition_variable inserted_cv_;
+      /// Notified after each write attempt
+      std::condition_variable written_cv_;
+
+      /// Serializes writes to the underlying storage with reads from it
+      mutable std::shared_timed_mutex storage_mutex_;
+
+      std::thread worker_;
+    };
+
+  }  // namespace ametsuchi
+}  // namespace iroha
+
+#endif  // IROHA_ASYNC_BLOCK_STORAGE_HPP
@@ -0,0 +1,143 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/cached_block_storage.hpp"
+
+#include <algorithm>
+#include <vector>
+
+#include "interfaces/iroha_internal/block.hpp"
+
+using namespace iroha::ametsuchi;
+using shared_model::interface::types::HeightType;
+
+constexpr size_t CachedBlockStorage::kDefaultCapacity;
+
+CachedBlockStorage::CachedBlockStorage(std::shared_ptr<BlockStorage> storage,
+                                       size_t capacity)
+    : storage_(std::move(storage)),
+      capacity_(capacity),
+      clears_(0),
+      hits_counter_(metrics::defaultRegistry().counter(
+          "iroha_block_cache_hits_total",
+          "Number of blocks fetched from the block cache")),
+      misses_counter_(metrics::defaultRegistry().counter(
+          "iroha_block_cache_misses_total",
+          "Number of blocks fetched from the block storage")) {}
+
+bool CachedBlockStorage::insert(
+    std::shared_ptr<const shared_model::interface::Block> block) {
+  if (not storage_->insert(block)) {
+    return false;
+  }
+  // the latest blocks are requested by lagging peers
+  std::lock_guard<std::mutex> lock(mutex_);
+  put(std::move(block));
+  return true;
+}
+
+boost::optional<std::shared_ptr<const shared_model::interface::Block>>
+CachedBlockStorage::fetch(HeightType height) const {
+  size_t clears;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (auto block = get(height)) {
+      hits_counter_.increment();
+      return block;
+    }
+    clears = clears_;
+  }
+  misses_counter_.increment();
+
+  auto block = storage_->fetch(height);
+  if (block) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    // the block could be removed from the storage while it was read
+    if (clears == clears_) {
+      put(*block);
+    }
+  }
+  return block;
+}
+
+size_t CachedBlockStorage::size() const {
+  return storage_->size();
+}
+
+void CachedBlockStorage::clear() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  storage_->clear();
+  blocks_.clear();
+  index_.clear();
+  ++clears_;
+}
+
+void CachedBlockStorage::forEach(FunctionType function) const {
+  storage_->forEach(std::move(function));
+}
+
+bool CachedBlockStorage::forRange(HeightType from,
+                                  HeightType to,
+                                  RangeFunctionType function) const {
+  // the end of the range is usually cached, since it contains the latest
+  // blocks
+  std::vector<BlockPtr> cached;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (auto height = to; height >= from and height > 0; --height) {
+      auto it = index_.find(height);
+      if (it == index_.end()) {
+        break;
+      }
+      cached.push_back(*it->second);
+    }
+  }
+  std::reverse(cached.begin(), cached.end());
+  auto stored_to = to - cached.size();
+
+  bool stopped = false;
+  if (from <= stored_to
+      and not storage_->forRange(
+              from, stored_to, [&stopped, &function](auto block) {
+                stopped = not function(std::move(block));
+                return not stopped;
+              })) {
+    return false;
+  }
+
+  for (const auto &block : cached) {
+    if (stopped) {
+      break;
+    }
+    stopped = not function(block);
+  }
+  return true;
+}
+
+void CachedBlockStorage::put(BlockPtr block) const {
+  if (capacity_ == 0) {
+    return;
+  }
+  auto height = block->height();
+  auto it = index_.find(height);
+  if (it != index_.end()) {
+    blocks_.erase(it->second);
+  }
+  blocks_.push_front(std::move(block));
+  index_[height] = blocks_.begin();
+  if (blocks_.size() > capacity_) {
+    index_.erase(blocks_.back()->height());
+    blocks_.pop_back();
+  }
+}
+
+CachedBlockStorage::BlockPtr CachedBlockStorage::get(HeightType height) const {
+  auto it = index_.find(height);
+  if (it == index_.end()) {
+    return nullptr;
+  }
+  blocks_.splice(blocks_.begin(), blocks_, it->second);
+  return *it->second;
+}
@@ -0,0 +1,94 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_CACHED_BLOCK_STORAGE_HPP
+#define IROHA_CACHED_BLOCK_STORAGE_HPP
+
+#include "ametsuchi/block_storage.hpp"
+
+#include <list>
+#include <mutex>
+#include <unordered_map>
+
+#include "metrics/metrics.hpp"
+
+namespace iroha {
+  namespace ametsuchi {
+
+    /**
+     * Block storage which keeps a bounded number of deserialized blocks in
+     * memory, so that blocks requested repeatedly are read once. Inserted and
+     * fetched blocks are cached, the least recently used ones are evicted.
+     * Blocks read by forEach and forRange are not cached, so that scans of
+     * the history do not evict recent blocks.
+     */
+    class CachedBlockStorage : public BlockStorage {
+     public:
+      /**
+       * @param storage - storage to read blocks from
+       * @param capacity - maximum number of cached blocks
+       */
+      CachedBlockStorage(std::shared_ptr<BlockStorage> storage,
+                         size_t capacity);
+
+      bool insert(
+          std::shared_ptr<const shared_model::interface::Block> block) override;
+
+      boost::optional<std::shared_ptr<const shared_model::interface::Block>>
+      fetch(shared_model::interface::types::HeightType height) const override;
+
+      size_t size() const override;
+
+      void clear() override;
+
+      void forEach(FunctionType function) const override;
+
+      bool forRange(shared_model::interface::types::HeightType from,
+                    shared_model::interface::types::HeightType to,
+                    RangeFunctionType function) const override;
+
+      static constexpr size_t kDefaultCapacity = 128;
+
+     private:
+      using BlockPtr = std::shared_ptr<const shared_model::interface::Block>;
+
+      /**
+       * Add the block to the cache and evict the least recently used blocks.
+       * Has to be called with mutex_ locked
+       * @param block - block to cache
+       */
+      void put(BlockPtr block) const;
+
+      /**
+       * Get the block from the cache and mark it as the most recently used.
+       * Has to be called with mutex_ locked
+       * @param height - height of the block
+       * @return cached block or nullptr
+       */
+      BlockPtr get(shared_model::interface::types::HeightType height) const;
+
+      std::shared_ptr<BlockStorage> storage_;
+      const size_t capacity_;
+
+      /// Cached blocks, the most recently used first
+      mutable std::list<BlockPtr> blocks_;
+      mutable std::unordered_map<shared_model::interface::types::HeightType,
+                                 std::list<BlockPtr>::iterator>
+          index_;
+
+      /// Number of clears, blocks read before a clear are not cached
+      size_t clears_;
+
+      mutable std::mutex mutex_;
+
+      /// Number of fetched blocks found and not found in the cache
+      metrics::Counter &hits_counter_;
+      metrics::Counter &misses_counter_;
+    };
+
+  }  // namespace ametsuchi
+}  // namespace iroha
+
+#endif  // IROHA_CACHED_BLOCK_STORAGE_HPP
@@ -5,11 +5,23 @@
 
 #include "ametsuchi/impl/flat_file/flat_file.hpp"
 
+#include <fcntl.h>
+#include <zlib.h>
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+#include <algorithm>
+#include <array>
 #include <ciso646>
 #include <iomanip>
 #include <iostream>
+#include <iterator>
 #include <sstream>
 
+#include <boost/algorithm/string/predicate.hpp>
+#include <boost/crc.hpp>
 #include <boost/filesystem.hpp>
 #include <boost/range/adaptor/indexed.hpp>
 #include <boost/range/algorithm/find_if.hpp>
@@ -20,6 +32,273 @@ using namespace iroha::ametsuchi;
 using Identifier = FlatFile::Identifier;
 using BlockIdCollectionType = FlatFile::BlockIdCollectionType;
 
+struct FlatFile::Segment {
+  /// First identifier of the segment
+  Identifier id;
+  std::map<Identifier, Bytes> files;
+};
+
+namespace {
+  /// Precedes the checksum in the end of a file. Starts with a zero byte,
+  /// which does not end serialized blocks
+  const std::array<uint8_t, 4> kChecksumMagic{{0, 'c', 'r', 'c'}};
+  const size_t kChecksumSize = sizeof(uint32_t);
+  const size_t kFooterSize = kChecksumMagic.size() + kChecksumSize;
+
+  const std::string kSegmentExtension = ".segment";
+  const std::string kTemporaryExtension = ".tmp";
+
+  enum class ChecksumState { kValid, kMissing, kInvalid };
+
+  void putUint32(FlatFile::Bytes &bytes, uint32_t value) {
+    for (size_t i = 0; i < sizeof(value); ++i) {
+      bytes.push_back(static_cast<uint8_t>(value >> (8 * i)));
+    }
+  }
+
+  uint32_t getUint32(const uint8_t *data) {
+    uint32_t value = 0;
+    for (size_t i = 0; i < sizeof(value); ++i) {
+      value |= static_cast<uint32_t>(data[i]) << (8 * i);
+    }
+    return value;
+  }
+
+  uint32_t checksum(const uint8_t *data, size_t size) {
+    boost::crc_32_type crc;
+    crc.process_bytes(data, size);
+    return crc.checksum();
+  }
+
+  /**
+   * @param data - contents of the file
+   * @return footer with the checksum of the data
+   */
+  FlatFile::Bytes makeFooter(const FlatFile::Bytes &data) {
+    FlatFile::Bytes footer(kChecksumMagic.begin(), kChecksumMagic.end());
+    putUint32(footer, checksum(data.data(), data.size()));
+    return footer;
+  }
+
+  /**
+   * @param footer - pointer to kFooterSize bytes in the end of a file
+   * @return checksum if the footer contains one
+   */
+  boost::optional<uint32_t> readFooter(const uint8_t *footer) {
+    if (not std::equal(kChecksumMagic.begin(), kChecksumMagic.end(), footer)) {
+      return boost::none;
+    }
+    return getUint32(footer + kChecksumMagic.size());
+  }
+
+  /**
+   * Verify the checksum in the end of file contents
+   * @param contents - contents of the file
+   * @return kMissing if the file has no checksum, which is the case for
+   * files written by previous versions
+   */
+  ChecksumState checkFooter(const FlatFile::Bytes &contents) {
+    if (contents.size() < kFooterSize) {
+      return ChecksumState::kMissing;
+    }
+    auto data_size = contents.size() - kFooterSize;
+    auto value = readFooter(contents.data() + data_size);
+    if (not value) {
+      return ChecksumState::kMissing;
+    }
+    return *value == checksum(contents.data(), data_size)
+        ? ChecksumState::kValid
+        : ChecksumState::kInvalid;
+  }
+
+  /**
+   * Verify the checksum of a file. The whole file is read only if it has
+   * a checksum
+   * @param path - path to the file
+   * @return state of the checksum, kInvalid if the file could not be read
+   */
+  ChecksumState checkFile(const boost::filesystem::path &path) {
+    boost::system::error_code err;
+    auto size = boost::filesystem::file_size(path, err);
+    if (err) {
+      return ChecksumState::kInvalid;
+    }
+    if (size < kFooterSize) {
+      // an empty file is never written completely
+      return size == 0 ? ChecksumState::kInvalid : ChecksumState::kMissing;
+    }
+
+    boost::filesystem::ifstream file(path, std::ifstream::binary);
+    std::array<uint8_t, kFooterSize> footer;
+    file.seekg(size - kFooterSize);
+    file.read(reinterpret_cast<char *>(footer.data()), footer.size());
+    if (not file) {
+      return ChecksumState::kInvalid;
+    }
+    if (not readFooter(footer.data())) {
+      return ChecksumState::kMissing;
+    }
+
+    FlatFile::Bytes contents(size);
+    file.seekg(0);
+    file.read(reinterpret_cast<char *>(contents.data()), size);
+    if (not file) {
+      return ChecksumState::kInvalid;
+    }
+    return checkFooter(contents);
+  }
+
+  /**
+   * @param path - path to the file
+   * @return contents of the file or boost::none if it could not be read
+   */
+  boost::optional<FlatFile::Bytes> readFile(
+      const boost::filesystem::path &path) {
+    boost::system::error_code err;
+    auto size = boost::filesystem::file_size(path, err);
+    if (err) {
+      return boost::none;
+    }
+    FlatFile::Bytes contents(size);
+    boost::filesystem::ifstream file(path, std::ifstream::binary);
+    file.read(reinterpret_cast<char *>(contents.data()), size);
+    if (not file) {
+      return boost::none;
+    }
+    return contents;
+  }
+
+  /**
+   * Flush contents of a file or a directory to the disk
+   * @param path - path to the file or the directory
+   * @return true on success
+   */
+  bool syncPath(const std::string &path) {
+#ifdef _WIN32
+    // directory entries are persisted along with the files
+    if (boost::filesystem::is_directory(path)) {
+      return true;
+    }
+    auto fd = ::_open(path.c_str(), _O_RDWR | _O_BINARY);
+    if (fd < 0) {
+      return false;
+    }
+    auto synced = ::_commit(fd) == 0;
+    ::_close(fd);
+#else
+    auto fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+      return false;
+    }
+    auto synced = ::fsync(fd) == 0;
+    ::close(fd);
+#endif
+    return synced;
+  }
+
+  /**
+   * @param id - first identifier of the segment
+   * @return name of the segment file
+   */
+  std::string segmentName(Identifier id) {
+    return FlatFile::id_to_name(id) + kSegmentExtension;
+  }
+
+  /**
+   * @param name - name of a file
+   * @return first identifier of the segment if the file is a segment
+   */
+  boost::optional<Identifier> segmentId(const std::string &name) {
+    if (not boost::algorithm::ends_with(name, kSegmentExtension)) {
+      return boost::none;
+    }
+    return FlatFile::name_to_id(
+        name.substr(0, name.size() - kSegmentExtension.size()));
+  }
+
+  /**
+   * Read identifiers of files in a segment. A segment consists of the number
+   * of files, identifiers and sizes of the files, compressed contents of the
+   * files and a checksum
+   * @param path - path to the segment
+   * @return identifiers or boost::none if the segment could not be read
+   */
+  boost::optional<std::vector<Identifier>> readSegmentIds(
+      const boost::filesystem::path &path) {
+    boost::system::error_code err;
+    auto size = boost::filesystem::file_size(path, err);
+    if (err or size < sizeof(uint32_t) + kFooterSize) {
+      return boost::none;
+    }
+    boost::filesystem::ifstream file(path, std::ifstream::binary);
+    std::array<uint8_t, sizeof(uint32_t)> count;
+    file.read(reinterpret_cast<char *>(count.data()), count.size());
+    if (not file) {
+      return boost::none;
+    }
+    const auto header_size =
+        size_t{getUint32(count.data())} * 2 * sizeof(uint32_t);
+    if (header_size > size - count.size() - kFooterSize) {
+      return boost::none;
+    }
+    FlatFile::Bytes header(header_size);
+    file.read(reinterpret_cast<char *>(header.data()), header.size());
+    if (not file) {
+      return boost::none;
+    }
+    std::vector<Identifier> ids;
+    for (size_t i = 0; i < header.size(); i += 2 * sizeof(uint32_t)) {
+      ids.push_back(getUint32(header.data() + i));
+    }
+    return ids;
+  }
+
+  /**
+   * Write a file with a checksum
+   * @param path - path to the file
+   * @param data - contents of the file
+   * @param sync - whether the file is synced to the disk
+   * @return true on success
+   */
+  bool writeFile(const boost::filesystem::path &path,
+                 const FlatFile::Bytes &data,
+                 bool sync) {
+    auto footer = makeFooter(data);
+    boost::filesystem::ofstream file(path, std::ofstream::binary);
+    file.write(reinterpret_cast<const char *>(data.data()), data.size());
+    file.write(reinterpret_cast<const char *>(footer.data()), footer.size());
+    file.close();
+    return file and (not sync or syncPath(path.string()));
+  }
+
+  boost::optional<FlatFile::Bytes> compressBytes(const FlatFile::Bytes &data) {
+    auto size = ::compressBound(data.size());
+    FlatFile::Bytes compressed(size);
+    if (::compress2(compressed.data(),
+                    &size,
+                    data.data(),
+                    data.size(),
+                    Z_BEST_SPEED)
+        != Z_OK) {
+      return boost::none;
+    }
+    compressed.resize(size);
+    return compressed;
+  }
+
+  boost::optional<FlatFile::Bytes> decompressBytes(const uint8_t *data,
+                                                   size_t size,
+                                                   size_t decompressed_size) {
+    FlatFile::Bytes decompressed(decompressed_size);
+    uLongf result_size = decompressed_size;
+    if (::uncompress(decompressed.data(), &result_size, data, size) != Z_OK
+        or result_size != decompressed_size) {
+      return boost::none;
+    }
+    return decompressed;
+  }
+}  // namespace
+
 // ----------| public API |----------
 
 std::string FlatFile::id_to_name(Identifier id) {
@@ -41,27 +320,140 @@ boost::optional<Identifier> FlatFile::name_to_id(const std::string &name) {
 }
 
 boost::optional<std::unique_ptr<FlatFile>> FlatFile::create(
-    const std::string &path, logger::LoggerPtr log) {
+    const std::string &path, logger::LoggerPtr log, FlatFileOptions options) {
   boost::system::error_code err;
   if (not boost::filesystem::is_directory(path, err)
       and not boost::filesystem::create_directory(path, err)) {
     log->error("Cannot create storage dir: {}\n{}", path, err.message());
     return boost::none;
   }
+  const auto cold_path = options.cold_path.value_or(path);
+  if (not boost::filesystem::is_directory(cold_path, err)
+      and not boost::filesystem::create_directory(cold_path, err)) {
+    log->error("Cannot create cold storage dir: {}\n{}",
+               cold_path,
+               err.message());
+    return boost::none;
+  }
 
   BlockIdCollectionType files_found;
+  std::map<Identifier, Identifier> segments;
+  auto load_segment = [&](const boost::filesystem::path &segment_path,
+                          Identifier segment_id) {
+    if (auto ids = readSegmentIds(segment_path)) {
+      for (auto id : *ids) {
+        segments.emplace(id, segment_id);
+      }
+    } else {
+      log->error("Cannot read segment {}", segment_path.string());
+    }
+  };
   for (auto it = boost::filesystem::directory_iterator{path};
        it != boost::filesystem::directory_iterator{};
        ++it) {
-    if (auto id = FlatFile::name_to_id(it->path().filename().string())) {
+    auto name = it->path().filename().string();
+    if (auto id = FlatFile::name_to_id(name)) {
       files_found.insert(*id);
-    } else {
+    } else if (auto segment_id = segmentId(name)) {
+      if (cold_path == path) {
+        load_segment(it->path(), *segment_id);
+      } else {
+        log->warn("Segment {} is not in the cold storage dir, ignoring", name);
+      }
+    } else if (not boost::filesystem::equivalent(it->path(), cold_path, err)) {
       boost::filesystem::remove(it->path());
     }
   }
+  if (cold_path != path) {
+    for (auto it = boost::filesystem::directory_iterator{cold_path};
+         it != boost::filesystem::directory_iterator{};
+         ++it) {
+      auto name = it->path().filename().string();
+      if (auto segment_id = segmentId(name)) {
+        load_segment(it->path(), *segment_id);
+      } else if (boost::algorithm::ends_with(name, kTemporaryExtension)) {
+        boost::filesystem::remove(it->path());
+      }
+    }
+  }
+
+  // A segment is complete once it is renamed, while files in it could be
+  // not removed yet
+  for (auto it = files_found.begin(); it != files_found.end();) {
+    if (segments.count(*it) != 0) {
+      boost::filesystem::remove(boost::filesystem::path{path} / id_to_name(*it),
+                                err);
+      it = files_found.erase(it);
+    } else {
+      ++it;
+    }
+  }
+
+  // Files are written in ascending order of identifiers, so only the last
+  // group could be synced partially. The scan stops when a whole group of
+  // files is valid.
+  std::vector<Identifier> torn;
+  std::vector<Identifier> without_checksum;
+  uint32_t valid_in_row = 0;
+  for (auto it = files_found.rbegin(); it != files_found.rend()
+       and (options.sync_interval == 0
+            or valid_in_row <= options.sync_interval);
+       ++it) {
+    switch (checkFile(boost::filesystem::path{path} / id_to_name(*it))) {
+      case ChecksumState::kValid:
+        // files of previous versions can not follow files with checksums
+        torn.insert(
+            torn.end(), without_checksum.begin(), without_checksum.end());
+        without_checksum.clear();
+        ++valid_in_row;
+        break;
+      case ChecksumState::kMissing:
+        without_checksum.push_back(*it);
+        valid_in_row = 0;
+        break;
+      case ChecksumState::kInvalid:
+        torn.push_back(*it);
+        valid_in_row = 0;
+        break;
+    }
+  }
+
+  for (auto id : torn) {
+    log->warn("Removing file {}, which was not written completely", id);
+    boost::filesystem::remove(boost::filesystem::path{path} / id_to_name(id),
+                              err);
+    files_found.erase(id);
+  }
+  if (not torn.empty() and options.sync_interval != 0 and not syncPath(path)) {
+    log->error("Cannot sync storage dir: {}", path);
+  }
+
+  for (const auto &segment : segments) {
+    files_found.insert(segment.first);
+  }
+  if (not files_found.empty()) {
+    auto first = *files_found.begin(), last = *files_found.rbegin();
+    auto expected = static_cast<size_t>(last - first) + 1;
+    if (files_found.size() != expected) {
+      auto gap = std::adjacent_find(
+          files_found.begin(), files_found.end(), [](auto lhs, auto rhs) {
+            return rhs != lhs + 1;
+          });
+      log->error(
+          "{} files are missing between {} and {}, the first missing is {}",
+          expected - files_found.size(),
+          first,
+          last,
+          *gap + 1);
+    }
+  }
 
-  return std::make_unique<FlatFile>(
-      path, std::move(files_found), private_tag{}, std::move(log));
+  return std::make_unique<FlatFile>(path,
+                                    std::move(files_found),
+                                    std::move(segments),
+                                    std::move(options),
+                                    private_tag{},
+                                    std::move(log));
 }
 
 bool FlatFile::add(Identifier id, const Bytes &block) {
@@ -70,7 +462,7 @@ bool FlatFile::add(Identifier id, const Bytes &block) {
   const auto file_name = boost::filesystem::path{dump_dir_} / id_to_name(id);
 
   // Write block to binary file
-  if (boost::filesystem::exists(file_name)) {
+  if (boost::filesystem::exists(file_name) or segmentOf(id)) {
     // File already exist
     log_->warn("insertion for {} failed, because file already exists", id);
     return false;
@@ -85,30 +477,72 @@ bool FlatFile::add(Identifier id, const Bytes &block) {
   auto val_size =
       sizeof(std::remove_reference<decltype(block)>::type::value_type);
 
+  auto footer = makeFooter(block);
   file.write(reinterpret_cast<const char *>(block.data()),
              block.size() * val_size);
+  file.write(reinterpret_cast<const char *>(footer.data()),
+             footer.size() * val_size);
+  file.close();
+  if (not file) {
+    log_->warn("Cannot write file by index {}", id);
+    boost::system::error_code err;
+    boost::filesystem::remove(file_name, err);
+    return false;
+  }
 
   available_blocks_.insert(id);
+  if (not scheduled_to_ or id > *scheduled_to_) {
+    ++hot_files_;
+  }
+  if (options_.sync_interval != 0) {
+    unsynced_.push_back(id);
+    if (unsynced_.size() >= options_.sync_interval) {
+      // the file is written anyway, the sync is retried with the next group
+      sync();
+    }
+  }
+  if (options_.segment_size != 0) {
+    scheduleCompression();
+  }
   return true;
 }
 
 boost::optional<FlatFile::Bytes> FlatFile::get(Identifier id) const {
-  const auto filename =
-      boost::filesystem::path{dump_dir_} / FlatFile::id_to_name(id);
-  if (not boost::filesystem::exists(filename)) {
-    log_->info("get({}) file not found", id);
+  auto segment_id = segmentOf(id);
+  if (not segment_id) {
+    const auto filename =
+        boost::filesystem::path{dump_dir_} / FlatFile::id_to_name(id);
+    if (auto buf = readFile(filename)) {
+      switch (checkFooter(*buf)) {
+        case ChecksumState::kValid:
+          buf->resize(buf->size() - kFooterSize);
+          break;
+        case ChecksumState::kMissing:
+          break;
+        case ChecksumState::kInvalid:
+          log_->error("get({}) checksum mismatch", id);
+          return boost::none;
+      }
+      return buf;
+    }
+    // the file could be packed into a segment and removed after the lookup
+    segment_id = segmentOf(id);
+    if (not segment_id) {
+      log_->info("get({}) file not found", id);
+      return boost::none;
+    }
+  }
+
+  auto segment = loadSegment(*segment_id);
+  if (not segment) {
     return boost::none;
   }
-  const auto fileSize = boost::filesystem::file_size(filename);
-  Bytes buf;
-  buf.resize(fileSize);
-  boost::filesystem::ifstream file(filename, std::ifstream::binary);
-  if (not file.is_open()) {
-    log_->info("get({}) problem with opening file", id);
+  auto file = segment->files.find(id);
+  if (file == segment->files.end()) {
+    log_->error("get({}) file not found in segment {}", id, segment->id);
     return boost::none;
   }
-  file.read(reinterpret_cast<char *>(buf.data()), fileSize);
-  return buf;
+  return file->second;
 }
 
 std::string FlatFile::directory() const {
@@ -120,20 +554,285 @@ Identifier FlatFile::last_id() const {
 }
 
 void FlatFile::dropAll() {
+  {
+    std::unique_lock<std::mutex> lock(compression_mutex_);
+    compression_queue_.clear();
+    compression_cv_.wait(lock, [this] { return not compressing_; });
+    failed_segments_.clear();
+  }
+  scheduled_to_ = boost::none;
+  hot_files_ = 0;
+
+  boost::system::error_code err;
+  std::lock_guard<std::mutex> segments_lock(segments_mutex_);
+  for (const auto &segment : segments_) {
+    // a segment is removed once, with its first file
+    if (segment.first == segment.second) {
+      boost::filesystem::remove(
+          boost::filesystem::path{cold_dir_} / segmentName(segment.first),
+          err);
+    }
+  }
   iroha::remove_dir_contents(dump_dir_, log_);
   available_blocks_.clear();
+  segments_.clear();
+  unsynced_.clear();
+  std::lock_guard<std::mutex> lock(last_segment_mutex_);
+  last_segment_.reset();
 }
 
 const BlockIdCollectionType &FlatFile::blockIdentifiers() const {
   return available_blocks_;
 }
 
+void FlatFile::waitCompression() {
+  std::unique_lock<std::mutex> lock(compression_mutex_);
+  compression_cv_.wait(lock, [this] {
+    return compression_queue_.empty() and not compressing_;
+  });
+}
+
+bool FlatFile::sync() {
+  if (unsynced_.empty()) {
+    return true;
+  }
+  for (auto id : unsynced_) {
+    const auto file_name =
+        boost::filesystem::path{dump_dir_} / id_to_name(id);
+    // files packed into segments are removed, and segments are synced
+    if (not syncPath(file_name.string()) and not segmentOf(id)) {
+      log_->error("Cannot sync file by index {}", id);
+      return false;
+    }
+  }
+  // new directory entries are not persisted by syncing the files
+  if (not syncPath(dump_dir_)) {
+    log_->error("Cannot sync storage dir: {}", dump_dir_);
+    return false;
+  }
+  unsynced_.clear();
+  return true;
+}
+
+FlatFile::~FlatFile() {
+  if (compression_worker_.joinable()) {
+    {
+      std::lock_guard<std::mutex> lock(compression_mutex_);
+      stop_ = true;
+    }
+    compression_cv_.notify_all();
+    compression_worker_.join();
+  }
+  sync();
+}
+
 // ----------| private API |----------
 
 FlatFile::FlatFile(std::string path,
                    BlockIdCollectionType existing_files,
+                   std::map<Identifier, Identifier> segments,
+                   FlatFileOptions options,
                    FlatFile::private_tag,
                    logger::LoggerPtr log)
     : dump_dir_(std::move(path)),
+      cold_dir_(options.cold_path.value_or(dump_dir_)),
       available_blocks_(std::move(existing_files)),
-      log_{std::move(log)} {}
+      segments_(std::move(segments)),
+      options_(std::move(options)),
+      log_{std::move(log)},
+      hot_files_(available_blocks_.size()),
+      compressing_(false),
+      stop_(false) {
+  if (options_.segment_size != 0) {
+    if (not segments_.empty()) {
+      scheduled_to_ = segments_.rbegin()->first;
+      hot_files_ = static_cast<size_t>(
+          std::distance(available_blocks_.upper_bound(*scheduled_to_),
+                        available_blocks_.end()));
+    }
+    compression_worker_ = std::thread(&FlatFile::runCompression, this);
+    // files which were not compressed before the restart
+    scheduleCompression();
+  }
+}
+
+void FlatFile::scheduleCompression() {
+  std::vector<std::vector<Identifier>> scheduled;
+  if (hot_files_ >= static_cast<size_t>(options_.hot_files)
+          + options_.segment_size) {
+    // segments contain the oldest files
+    auto hot_begin = scheduled_to_
+        ? available_blocks_.upper_bound(*scheduled_to_)
+        : available_blocks_.begin();
+    while (hot_files_ >= static_cast<size_t>(options_.hot_files)
+               + options_.segment_size) {
+      auto hot_end = std::next(hot_begin, options_.segment_size);
+      scheduled.emplace_back(hot_begin, hot_end);
+      scheduled_to_ = scheduled.back().back();
+      hot_begin = hot_end;
+      hot_files_ -= options_.segment_size;
+    }
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(compression_mutex_);
+    if (scheduled.empty() and failed_segments_.empty()) {
+      return;
+    }
+    // the failed segments are retried first, since they are the oldest
+    std::move(failed_segments_.begin(),
+              failed_segments_.end(),
+              std::back_inserter(compression_queue_));
+    failed_segments_.clear();
+    std::move(scheduled.begin(),
+              scheduled.end(),
+              std::back_inserter(compression_queue_));
+  }
+  compression_cv_.notify_all();
+}
+
+void FlatFile::runCompression() {
+  std::unique_lock<std::mutex> lock(compression_mutex_);
+  while (true) {
+    compression_cv_.wait(
+        lock, [this] { return stop_ or not compression_queue_.empty(); });
+    if (stop_) {
+      // the remaining files are scheduled again after the restart
+      return;
+    }
+    auto ids = std::move(compression_queue_.front());
+    compression_queue_.pop_front();
+    compressing_ = true;
+    lock.unlock();
+
+    auto compressed = compressSegment(ids);
+
+    lock.lock();
+    if (not compressed) {
+      // retried with the next added file
+      failed_segments_.push_back(std::move(ids));
+    }
+    compressing_ = false;
+    compression_cv_.notify_all();
+  }
+}
+
+bool FlatFile::compressSegment(const std::vector<Identifier> &ids) {
+  Bytes segment, contents;
+  putUint32(segment, ids.size());
+  for (auto id : ids) {
+    auto file = get(id);
+    if (not file) {
+      log_->error("Cannot compress file by index {}", id);
+      return false;
+    }
+    putUint32(segment, id);
+    putUint32(segment, file->size());
+    contents.insert(contents.end(), file->begin(), file->end());
+  }
+  auto compressed = compressBytes(contents);
+  if (not compressed) {
+    log_->error("Cannot compress files {}-{}", ids.front(), ids.back());
+    return false;
+  }
+  segment.insert(segment.end(), compressed->begin(), compressed->end());
+
+  // the segment has to be persisted before the files are removed
+  const auto sync = options_.sync_interval != 0;
+  const auto segment_name =
+      boost::filesystem::path{cold_dir_} / segmentName(ids.front());
+  auto temporary_name = segment_name;
+  temporary_name += kTemporaryExtension;
+  boost::system::error_code err;
+  auto written = writeFile(temporary_name, segment, sync);
+  if (written) {
+    boost::filesystem::rename(temporary_name, segment_name, err);
+    written = not err;
+  }
+  if (written and sync) {
+    written = syncPath(cold_dir_);
+  }
+  if (not written) {
+    log_->error("Cannot write segment {}", segment_name.string());
+    boost::filesystem::remove(temporary_name, err);
+    return false;
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(segments_mutex_);
+    for (auto id : ids) {
+      segments_.emplace(id, ids.front());
+    }
+  }
+  for (auto id : ids) {
+    boost::filesystem::remove(
+        boost::filesystem::path{dump_dir_} / id_to_name(id), err);
+  }
+  log_->info("Compressed files {}-{} from {} to {} bytes",
+             ids.front(),
+             ids.back(),
+             contents.size(),
+             compressed->size());
+  return true;
+}
+
+boost::optional<Identifier> FlatFile::segmentOf(Identifier id) const {
+  std::lock_guard<std::mutex> lock(segments_mutex_);
+  auto segment = segments_.find(id);
+  if (segment == segments_.end()) {
+    return boost::none;
+  }
+  return segment->second;
+}
+
+std::shared_ptr<const FlatFile::Segment> FlatFile::loadSegment(
+    Identifier segment_id) const {
+  {
+    std::lock_guard<std::mutex> lock(last_segment_mutex_);
+    if (last_segment_ and last_segment_->id == segment_id) {
+      return last_segment_;
+    }
+  }
+
+  const auto segment_name =
+      boost::filesystem::path{cold_dir_} / segmentName(segment_id);
+  auto file = readFile(segment_name);
+  if (not file or checkFooter(*file) != ChecksumState::kValid) {
+    log_->error("Cannot read segment {}", segment_name.string());
+    return nullptr;
+  }
+
+  const auto data_size = file->size() - kFooterSize;
+  const auto count = getUint32(file->data());
+  const auto header_size = sizeof(uint32_t) * (1 + 2 * size_t{count});
+  if (header_size > data_size) {
+    log_->error("Segment {} is malformed", segment_name.string());
+    return nullptr;
+  }
+  size_t contents_size = 0;
+  for (size_t i = 0; i < count; ++i) {
+    contents_size +=
+        getUint32(file->data() + sizeof(uint32_t) * (2 + 2 * i));
+  }
+  auto contents = decompressBytes(file->data() + header_size,
+                                  data_size - header_size,
+                                  contents_size);
+  if (not contents) {
+    log_->error("Cannot decompress segment {}", segment_name.string());
+    return nullptr;
+  }
+
+  auto segment = std::make_shared<Segment>();
+  segment->id = segment_id;
+  auto position = contents->begin();
+  for (size_t i = 0; i < count; ++i) {
+    auto entry = file->data() + sizeof(uint32_t) * (1 + 2 * i);
+    auto size = getUint32(entry + sizeof(uint32_t));
+    segment->files.emplace(getUint32(entry), Bytes(position, position + size));
+    position += size;
+  }
+
+  std::lock_guard<std::mutex> lock(last_segment_mutex_);
+  last_segment_ = segment;
+  return segment;
+}
@@ -8,9 +8,16 @@
 
 #include "ametsuchi/key_value_storage.hpp"
 
+#include <condition_variable>
+#include <deque>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <set>
+#include <thread>
+#include <vector>
 
+#include "ametsuchi/impl/flat_file/flat_file_options.hpp"
 #include "logger/logger_fwd.hpp"
 
 namespace iroha {
@@ -18,6 +25,18 @@ namespace iroha {
 
     /**
      * Solid storage based on raw files
+     *
+     * Each file ends with a checksum of its contents. Files are synced to the
+     * disk in groups: written files and the directory are synced after every
+     * sync_interval files, so that a power loss loses at most the last group.
+     * Files which were not synced completely are detected by the checksum and
+     * removed when the storage is created.
+     *
+     * When compression is enabled, the oldest files except the latest
+     * hot_files are packed by segment_size into compressed segments, which
+     * can be stored in a separate folder. Segments are compressed in a
+     * background thread, so add does not wait for them. Segments replace the
+     * files atomically and are read transparently by get.
      */
     class FlatFile : public KeyValueStorage {
       /**
@@ -55,13 +74,17 @@ namespace iroha {
       static boost::optional<Identifier> name_to_id(const std::string &name);
 
       /**
-       * Create storage in paths
+       * Create storage in paths. Files which were not written completely are
+       * removed, missing identifiers are reported
        * @param path - target path for creating
        * @param log - logger
+       * @param options - sync and compression parameters
        * @return created storage
        */
       static boost::optional<std::unique_ptr<FlatFile>> create(
-          const std::string &path, logger::LoggerPtr log);
+          const std::string &path,
+          logger::LoggerPtr log,
+          FlatFileOptions options = FlatFileOptions());
 
       bool add(Identifier id, const Bytes &blob) override;
 
@@ -78,6 +101,19 @@ namespace iroha {
        */
       const BlockIdCollectionType &blockIdentifiers() const;
 
+      /**
+       * Wait until the segments scheduled by the previous additions are
+       * written
+       */
+      void waitCompression();
+
+      /**
+       * Sync files written since the previous sync and the directory to the
+       * disk
+       * @return true if the sync succeeded
+       */
+      bool sync();
+
       // ----------| modify operations |----------
 
       FlatFile(const FlatFile &rhs) = delete;
@@ -94,25 +130,97 @@ namespace iroha {
        * Create storage in path
        * @param path - folder of storage
        * @param existing_files - collection of existing files names
+       * @param segments - identifiers of files in cold segments mapped to the
+       * first identifiers of the segments
+       * @param options - sync and compression parameters
        * @param log to print progress
        */
       FlatFile(std::string path,
                BlockIdCollectionType existing_files,
+               std::map<Identifier, Identifier> segments,
+               FlatFileOptions options,
                FlatFile::private_tag,
                logger::LoggerPtr log);
 
      private:
+      /// Decompressed contents of a cold segment
+      struct Segment;
+
+      /**
+       * Schedule the oldest hot files to be packed into segments if there are
+       * enough of them. Called by the writer only
+       */
+      void scheduleCompression();
+
+      /// Body of the background compression thread
+      void runCompression();
+
+      /**
+       * Pack the files into a segment and remove them
+       * @param ids - identifiers of the files in ascending order
+       * @return true if the segment is written
+       */
+      bool compressSegment(const std::vector<Identifier> &ids);
+
+      /**
+       * @param id - identifier of a file
+       * @return first identifier of the segment containing the file, or
+       * boost::none if the file is not compressed
+       */
+      boost::optional<Identifier> segmentOf(Identifier id) const;
+
+      /**
+       * @param segment_id - first identifier of the segment
+       * @return decompressed segment or nullptr if it could not be read
+       */
+      std::shared_ptr<const Segment> loadSegment(Identifier segment_id) const;
+
       /**
        * Folder of storage
        */
       const std::string dump_dir_;
 
+      /// Folder of cold segments
+      const std::string cold_dir_;
+
       BlockIdCollectionType available_blocks_;
 
+      /// Identifiers of files in cold segments mapped to the first
+      /// identifiers of the segments
+      std::map<Identifier, Identifier> segments_;
+      mutable std::mutex segments_mutex_;
+
+      const FlatFileOptions options_;
+
+      /// The last read segment, sequential reads of cold files hit it
+      mutable std::shared_ptr<const Segment> last_segment_;
+      mutable std::mutex last_segment_mutex_;
+
+      /// Files written since the previous sync
+      std::vector<Identifier> unsynced_;
+
       logger::LoggerPtr log_;
 
+      /// The last file scheduled for compression
+      boost::optional<Identifier> scheduled_to_;
+      /// Number of files after the last scheduled one
+      size_t hot_files_;
+
+      /// Files to be packed into segments, by segment
+      std::deque<std::vector<Identifier>> compression_queue_;
+      /// Segments which could not be written, they are scheduled again
+      std::vector<std::vector<Identifier>> failed_segments_;
+      bool compressing_;
+      bool stop_;
+      std::mutex compression_mutex_;
+      /// Notified when segments are scheduled, written or the thread has to
+      /// stop
+      std::condition_variable compression_cv_;
+      std::thread compression_worker_;
+
      public:
-      ~FlatFile() = default;
+      /// Stops the compression and syncs the remaining files
+      ~FlatFile();
     };
   }  // namespace ametsuchi
 }  // namespace iroha
@@ -0,0 +1,38 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_FLAT_FILE_OPTIONS_HPP
+#define IROHA_FLAT_FILE_OPTIONS_HPP
+
+#include <cstdint>
+#include <string>
+
+#include <boost/optional.hpp>
+
+namespace iroha {
+  namespace ametsuchi {
+
+    /**
+     * Durability and tiering parameters of FlatFile
+     */
+    struct FlatFileOptions {
+      /// Number of files written between syncs to the disk, 0 disables syncs
+      uint32_t sync_interval = 1;
+
+      /// Number of files compressed into a single cold segment, 0 disables
+      /// compression
+      uint32_t segment_size = 0;
+
+      /// Number of the latest files which are never compressed
+      uint32_t hot_files = 1000;
+
+      /// Folder for cold segments, the storage folder is used if not set
+      boost::optional<std::string> cold_path;
+    };
+
+  }  // namespace ametsuchi
+}  // namespace iroha
+
+#endif  // IROHA_FLAT_FILE_OPTIONS_HPP
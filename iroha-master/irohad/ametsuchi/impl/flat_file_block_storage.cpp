@@ -5,6 +5,10 @@
 
 #include "ametsuchi/impl/flat_file_block_storage.hpp"
 
+#include <condition_variable>
+#include <deque>
+#include <thread>
+
 #include <boost/filesystem.hpp>
 
 #include "backend/protobuf/block.hpp"
@@ -13,6 +17,8 @@
 
 using namespace iroha::ametsuchi;
 
+constexpr size_t FlatFileBlockStorage::kPrefetchBlocks;
+
 FlatFileBlockStorage::FlatFileBlockStorage(
     std::unique_ptr<FlatFile> flat_file,
     std::shared_ptr<shared_model::interface::BlockJsonConverter> json_converter,
@@ -42,7 +48,12 @@ FlatFileBlockStorage::fetch(
     return boost::none;
   }
 
-  return json_converter_->deserialize(bytesToString(*storage_block))
+  return deserialize(*storage_block);
+}
+
+boost::optional<std::shared_ptr<const shared_model::interface::Block>>
+FlatFileBlockStorage::deserialize(const FlatFile::Bytes &block_bytes) const {
+  return json_converter_->deserialize(bytesToString(block_bytes))
       .match(
           [&](auto &&block) {
             return boost::make_optional<
@@ -67,9 +78,100 @@ void FlatFileBlockStorage::clear() {
 
 void FlatFileBlockStorage::forEach(
     iroha::ametsuchi::BlockStorage::FunctionType function) const {
-  for (auto block_id : flat_file_storage_->blockIdentifiers()) {
-    auto block = fetch(block_id);
-    BOOST_ASSERT(block);
-    function(*block);
+  const auto &block_ids = flat_file_storage_->blockIdentifiers();
+  if (block_ids.empty()) {
+    return;
+  }
+  if (not forRange(
+          *block_ids.begin(), *block_ids.rbegin(), [&function](auto block) {
+            function(std::move(block));
+            return true;
+          })) {
+    log_->error("Failed to read blocks from {}",
+                flat_file_storage_->directory());
+  }
+}
+
+bool FlatFileBlockStorage::forRange(
+    shared_model::interface::types::HeightType from,
+    shared_model::interface::types::HeightType to,
+    RangeFunctionType function) const {
+  const auto &block_ids = flat_file_storage_->blockIdentifiers();
+  const std::vector<FlatFile::Identifier> range(block_ids.lower_bound(from),
+                                                block_ids.upper_bound(to));
+  if (range.empty()) {
+    return true;
+  }
+
+  // a single reader thread reads the files ahead of the deserialization,
+  // keeping at most kPrefetchBlocks of them in memory
+  std::mutex mutex;
+  std::condition_variable cv;
+  std::deque<boost::optional<FlatFile::Bytes>> prefetched;
+  bool stopped = false;
+  std::thread reader([&] {
+    for (auto block_id : range) {
+      {
+        std::unique_lock<std::mutex> lock(mutex);
+        cv.wait(lock, [&] {
+          return stopped or prefetched.size() < kPrefetchBlocks;
+        });
+        if (stopped) {
+          return;
+        }
+      }
+      auto block_bytes = flat_file_storage_->get(block_id);
+      {
+        std::lock_guard<std::mutex> lock(mutex);
+        prefetched.push_back(std::move(block_bytes));
+      }
+      cv.notify_all();
+    }
+  });
+  auto stop_reader = [&] {
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      stopped = true;
+    }
+    cv.notify_all();
+    reader.join();
+  };
+
+  bool result = true;
+  try {
+    for (auto it = range.begin(); it != range.end(); ++it) {
+      if (it != range.begin() and *it != *std::prev(it) + 1) {
+        log_->error("Block with height {} is missing in {}",
+                    *std::prev(it) + 1,
+                    flat_file_storage_->directory());
+        result = false;
+        break;
+      }
+      boost::optional<FlatFile::Bytes> block_bytes;
+      {
+        std::unique_lock<std::mutex> lock(mutex);
+        cv.wait(lock, [&] { return not prefetched.empty(); });
+        block_bytes = std::move(prefetched.front());
+        prefetched.pop_front();
+      }
+      cv.notify_all();
+      if (not block_bytes) {
+        result = false;
+        break;
+      }
+      auto block = deserialize(*block_bytes);
+      if (not block) {
+        result = false;
+        break;
+      }
+      if (not function(std::move(*block))) {
+        break;
+      }
+    }
+  } catch (...) {
+    stop_reader();
+    throw;
   }
+  stop_reader();
+  return result;
 }
@@ -16,6 +16,9 @@ namespace iroha {
   namespace ametsuchi {
     class FlatFileBlockStorage : public BlockStorage {
      public:
+      /// number of files which forRange reads ahead of the deserialization
+      static constexpr size_t kPrefetchBlocks = 4;
+
       FlatFileBlockStorage(
           std::unique_ptr<FlatFile> flat_file,
           std::shared_ptr<shared_model::interface::BlockJsonConverter>
@@ -34,7 +37,18 @@ namespace iroha {
 
       void forEach(FunctionType function) const override;
 
+      bool forRange(shared_model::interface::types::HeightType from,
+                    shared_model::interface::types::HeightType to,
+                    RangeFunctionType function) const override;
+
      private:
+      /**
+       * Deserialize block read from the flat file
+       * @return block or boost::none if block bytes are malformed
+       */
+      boost::optional<std::shared_ptr<const shared_model::interface::Block>>
+      deserialize(const FlatFile::Bytes &block_bytes) const;
+
       std::unique_ptr<FlatFile> flat_file_storage_;
       std::shared_ptr<shared_model::interface::BlockJsonConverter>
           json_converter_;
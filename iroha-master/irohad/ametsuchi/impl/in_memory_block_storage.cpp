@@ -37,3 +37,19 @@ void InMemoryBlockStorage::forEach(FunctionType function) const {
     function(pair.second);
   }
 }
+
+bool InMemoryBlockStorage::forRange(
+    shared_model::interface::types::HeightType from,
+    shared_model::interface::types::HeightType to,
+    RangeFunctionType function) const {
+  auto begin = block_store_.lower_bound(from);
+  for (auto it = begin; it != block_store_.end() and it->first <= to; ++it) {
+    if (it != begin and it->first != std::prev(it)->first + 1) {
+      return false;
+    }
+    if (not function(it->second)) {
+      break;
+    }
+  }
+  return true;
+}
@@ -30,6 +30,10 @@ namespace iroha {
 
       void forEach(FunctionType function) const override;
 
+      bool forRange(shared_model::interface::types::HeightType from,
+                    shared_model::interface::types::HeightType to,
+                    RangeFunctionType function) const override;
+
      private:
       std::map<shared_model::interface::types::HeightType,
                std::shared_ptr<const shared_model::interface::Block>>
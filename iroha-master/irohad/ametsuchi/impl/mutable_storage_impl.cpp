@@ -7,6 +7,7 @@
 
 #include <boost/variant/apply_visitor.hpp>
 #include "ametsuchi/impl/peer_query_wsv.hpp"
+#include "ametsuchi/impl/peer_registry.hpp"
 #include "ametsuchi/impl/postgres_block_index.hpp"
 #include "ametsuchi/impl/postgres_indexer.hpp"
 #include "ametsuchi/impl/postgres_wsv_command.hpp"
@@ -37,7 +38,10 @@ namespace iroha {
           transaction_executor_(std::move(transaction_executor)),
           block_storage_(std::move(block_storage)),
           committed(false),
-          log_(log_manager->getLogger()) {
+          log_(log_manager->getLogger()),
+          apply_duration_histogram_(metrics::defaultRegistry().histogram(
+              "iroha_storage_apply_duration_seconds",
+              "Time of applying a block to the world state view")) {
       *sql_ << "BEGIN";
     }
 
@@ -52,6 +56,7 @@ namespace iroha {
       log_->info("Applying block: height {}, hash {}",
                  block->height(),
                  block->hash().hex());
+      metrics::ScopedTimer timer(apply_duration_histogram_);
 
       auto block_applied =
           (not ledger_state_ or predicate(block, *ledger_state_.value()))
@@ -62,7 +67,11 @@ namespace iroha {
         block_storage_->insert(block);
         block_index_->index(*block);
 
-        auto opt_ledger_peers = peer_query_->getLedgerPeers();
+        // peers are read from WSV only if the block could have changed them
+        auto opt_ledger_peers =
+            ledger_state_ and not PeerRegistry::changesPeers(*block)
+            ? boost::make_optional(ledger_state_.value()->ledger_peers)
+            : peer_query_->getLedgerPeers();
         if (not opt_ledger_peers) {
           log_->error("Failed to get ledger peers!");
           return false;
@@ -13,6 +13,7 @@
 #include "interfaces/common_objects/types.hpp"
 #include "logger/logger_fwd.hpp"
 #include "logger/logger_manager_fwd.hpp"
+#include "metrics/metrics.hpp"
 
 namespace iroha {
   namespace ametsuchi {
@@ -71,6 +72,9 @@ namespace iroha {
       bool committed;
 
       logger::LoggerPtr log_;
+
+      /// Time of applying a block to the WSV
+      metrics::Histogram &apply_duration_histogram_;
     };
   }  // namespace ametsuchi
 }  // namespace iroha
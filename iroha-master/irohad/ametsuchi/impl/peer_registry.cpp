@@ -0,0 +1,98 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/peer_registry.hpp"
+
+#include <algorithm>
+
+#include "common/visitor.hpp"
+#include "interfaces/commands/add_peer.hpp"
+#include "interfaces/commands/command_variant.hpp"
+#include "interfaces/commands/remove_peer.hpp"
+#include "interfaces/iroha_internal/block.hpp"
+
+using namespace iroha::ametsuchi;
+using shared_model::interface::types::PeerList;
+
+PeerRegistry::PeerRegistry(LoaderType load)
+    : load_(std::move(load)), version_(0) {}
+
+std::shared_ptr<const PeerRegistry::Snapshot> PeerRegistry::get() {
+  auto snapshot = std::atomic_load(&snapshot_);
+  if (snapshot) {
+    return snapshot;
+  }
+
+  std::lock_guard<std::mutex> load_lock(load_mutex_);
+  // peers could have been loaded while waiting for the lock
+  snapshot = std::atomic_load(&snapshot_);
+  if (snapshot) {
+    return snapshot;
+  }
+
+  uint64_t version;
+  {
+    std::lock_guard<std::mutex> lock(replace_mutex_);
+    version = version_;
+  }
+  auto peers = load_();
+  if (not peers) {
+    return nullptr;
+  }
+
+  std::lock_guard<std::mutex> lock(replace_mutex_);
+  snapshot = std::make_shared<const Snapshot>(
+      Snapshot{std::move(*peers), version});
+  // the loaded peers are outdated if a block was committed meanwhile
+  if (version == version_) {
+    std::atomic_store(&snapshot_, snapshot);
+  }
+  return snapshot;
+}
+
+boost::optional<std::vector<PeerQuery::wPeer>> PeerRegistry::getLedgerPeers() {
+  auto snapshot = get();
+  if (not snapshot) {
+    return boost::none;
+  }
+  return snapshot->peers;
+}
+
+void PeerRegistry::update(PeerList peers) {
+  replace(std::move(peers));
+}
+
+void PeerRegistry::invalidate() {
+  replace(boost::none);
+}
+
+bool PeerRegistry::changesPeers(const shared_model::interface::Block &block) {
+  return std::any_of(
+      block.transactions().begin(),
+      block.transactions().end(),
+      [](const auto &tx) {
+        return std::any_of(
+            tx.commands().begin(), tx.commands().end(), [](const auto &cmd) {
+              return iroha::visit_in_place(
+                  cmd.get(),
+                  [](const shared_model::interface::AddPeer &) { return true; },
+                  [](const shared_model::interface::RemovePeer &) {
+                    return true;
+                  },
+                  [](const auto &) { return false; });
+            });
+      });
+}
+
+void PeerRegistry::replace(boost::optional<PeerList> peers) {
+  std::lock_guard<std::mutex> lock(replace_mutex_);
+  ++version_;
+  std::shared_ptr<const Snapshot> snapshot;
+  if (peers) {
+    snapshot =
+        std::make_shared<const Snapshot>(Snapshot{std::move(*peers), version_});
+  }
+  std::atomic_store(&snapshot_, std::move(snapshot));
+}
@@ -0,0 +1,96 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_PEER_REGISTRY_HPP
+#define IROHA_PEER_REGISTRY_HPP
+
+#include "ametsuchi/peer_query.hpp"
+
+#include <functional>
+#include <mutex>
+
+#include "interfaces/common_objects/types.hpp"
+
+namespace shared_model {
+  namespace interface {
+    class Block;
+  }  // namespace interface
+}  // namespace shared_model
+
+namespace iroha {
+  namespace ametsuchi {
+
+    /**
+     * Peers of the committed ledger, shared by all the components which need
+     * them. The list is read without locks and is replaced only when a block
+     * which adds or removes peers is committed.
+     */
+    class PeerRegistry : public PeerQuery {
+     public:
+      /// Function which reads peers from the storage
+      using LoaderType = std::function<
+          boost::optional<shared_model::interface::types::PeerList>()>;
+
+      /// Peers with the version of the registry they belong to
+      struct Snapshot {
+        shared_model::interface::types::PeerList peers;
+        uint64_t version;
+      };
+
+      /**
+       * @param load - function to read peers when they are not known
+       */
+      explicit PeerRegistry(LoaderType load);
+
+      /**
+       * Get current peers, load them if they are not known
+       * @return peers or nullptr if they could not be loaded
+       */
+      std::shared_ptr<const Snapshot> get();
+
+      boost::optional<std::vector<wPeer>> getLedgerPeers() override;
+
+      /**
+       * Replace the peers
+       * @param peers - peers of the committed ledger
+       */
+      void update(shared_model::interface::types::PeerList peers);
+
+      /// Forget the peers, so that they are loaded on the next request
+      void invalidate();
+
+      /**
+       * @param block - block to check
+       * @return true if the block contains commands which add or remove peers
+       */
+      static bool changesPeers(const shared_model::interface::Block &block);
+
+     private:
+      /**
+       * Replace the snapshot and increment the version
+       * @param peers - new peers or boost::none to forget them
+       */
+      void replace(
+          boost::optional<shared_model::interface::types::PeerList> peers);
+
+      LoaderType load_;
+
+      /// Accessed with std::atomic_load and std::atomic_store only
+      std::shared_ptr<const Snapshot> snapshot_;
+
+      /// Guarded by replace_mutex_
+      uint64_t version_;
+
+      /// Serializes replacements of the snapshot
+      std::mutex replace_mutex_;
+
+      /// Serializes loads, so that peers are loaded once after invalidation
+      std::mutex load_mutex_;
+    };
+
+  }  // namespace ametsuchi
+}  // namespace iroha
+
+#endif  // IROHA_PEER_REGISTRY_HPP
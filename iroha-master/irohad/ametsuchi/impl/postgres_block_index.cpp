@@ -72,6 +72,7 @@ void PostgresBlockIndex::index(const shared_model::interface::Block &block) {
 
     makeAccountAssetIndex(creator_id, position, tx.value().commands());
     indexer_->txHashPosition(tx.value().hash(), position);
+    indexer_->txBlobPosition(tx.value().blob(), position);
     indexer_->committedTxHash(tx.value().hash());
     indexer_->txPositionByCreator(creator_id, position);
   }
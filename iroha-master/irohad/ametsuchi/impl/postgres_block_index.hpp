@@ -17,6 +17,7 @@ namespace iroha {
     /**
      * Creates several indices for passed blocks. Namely:
      * transaction hash -> block, where this transaction is stored
+     * (block, index) -> serialized transaction
      * transaction creator -> block where his transaction is located
      *
      * Additionally, for each Transfer Asset command:
@@ -38,6 +38,21 @@ namespace iroha {
       return clone(**block);
     }
 
+    expected::Result<void, BlockQuery::GetBlockError>
+    PostgresBlockQuery::forEachBlock(
+        shared_model::interface::types::HeightType from,
+        shared_model::interface::types::HeightType to,
+        BlockFunctionType function) {
+      if (not block_storage_.forRange(from, to, std::move(function))) {
+        auto error =
+            boost::format("Failed to retrieve blocks with heights %d to %d")
+            % from % to;
+        return expected::makeError(GetBlockError{
+            GetBlockError::Code::kInternalError, error.str()});
+      }
+      return {};
+    }
+
     shared_model::interface::types::HeightType
     PostgresBlockQuery::getTopBlockHeight() {
       return block_storage_.size();
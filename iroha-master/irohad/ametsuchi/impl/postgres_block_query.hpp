@@ -32,6 +32,11 @@ namespace iroha {
       BlockResult getBlock(
           shared_model::interface::types::HeightType height) override;
 
+      expected::Result<void, GetBlockError> forEachBlock(
+          shared_model::interface::types::HeightType from,
+          shared_model::interface::types::HeightType to,
+          BlockFunctionType function) override;
+
       shared_model::interface::types::HeightType getTopBlockHeight() override;
 
       boost::optional<TxCacheStatusType> checkTxPresence(
@@ -5,11 +5,60 @@
 
 #include "ametsuchi/impl/postgres_block_storage.hpp"
 
-#include "common/hexutils.hpp"
+#include <soci/postgresql/soci-postgresql.h>
 #include "logger/logger.hpp"
 
 using namespace iroha::ametsuchi;
 
+namespace {
+  /// libpq result, which is freed when it goes out of scope
+  using PgResult = std::unique_ptr<PGresult, decltype(&PQclear)>;
+
+  /// @return libpq connection of the session
+  PGconn *connection(soci::session &sql) {
+    return static_cast<soci::postgresql_session_backend *>(sql.get_backend())
+        ->conn_;
+  }
+
+  /**
+   * Execute select query and get its result in binary format, so that blocks
+   * are transferred as raw bytes
+   * @param sql - session to execute the query in
+   * @param query - query with $n placeholders
+   * @param params - text values of the placeholders
+   * @param log - logger to report errors to
+   * @return result of the query or boost::none in case of error
+   */
+  boost::optional<PgResult> selectBinary(
+      soci::session &sql,
+      const std::string &query,
+      const std::vector<std::string> &params,
+      const logger::LoggerPtr &log) {
+    std::vector<const char *> values;
+    values.reserve(params.size());
+    for (const auto &param : params) {
+      values.push_back(param.c_str());
+    }
+    PgResult result(PQexecParams(connection(sql),
+                                 query.c_str(),
+                                 static_cast<int>(values.size()),
+                                 nullptr,
+                                 values.data(),
+                                 nullptr,
+                                 nullptr,
+                                 1),
+                    &PQclear);
+    if (PQresultStatus(result.get()) != PGRES_TUPLES_OK) {
+      log->error("Failed to execute query: {}",
+                 PQresultErrorMessage(result.get()));
+      return boost::none;
+    }
+    return boost::optional<PgResult>(std::move(result));
+  }
+}  // namespace
+
+constexpr size_t PostgresBlockStorage::kFetchBatchSize;
+
 PostgresBlockStorage::PostgresBlockStorage(
     std::shared_ptr<PoolWrapper> pool_wrapper,
     std::shared_ptr<BlockTransportFactory> block_factory,
@@ -22,147 +71,211 @@ PostgresBlockStorage::PostgresBlockStorage(
 
 bool PostgresBlockStorage::insert(
     std::shared_ptr<const shared_model::interface::Block> block) {
-  shared_model::interface::types::HeightType last_block = 0;
-  using T = boost::tuple<shared_model::interface::types::HeightType>;
   soci::session sql(*pool_wrapper_->connection_pool_);
-  auto result_last_block = execute<T>(
-      [&] { return (sql.prepare << "SELECT MAX(height) FROM " << table_); });
-  try {
-    last_block =
-        flatMapValue<
-            boost::optional<shared_model::interface::types::HeightType>>(
-            result_last_block,
-            [](auto &last) { return boost::make_optional(last); })
-            .value_or(0);
-  } catch (const std::exception &e) {
-    log_->warn("Problem with a query result parsing: {}", e.what());
+  std::lock_guard<std::mutex> lock(state_mutex_);
+  auto state = loadState(sql);
+  if (not state) {
+    return false;
   }
 
-  if (last_block != 0) {
-    if (block->height() != last_block + 1) {
-      log_->warn(
-          "Only blocks with sequential heights could be inserted. Last block "
-          "height: {}, inserting: {}",
-          last_block,
-          block->height());
-      return false;
-    }
+  if (state->size != 0 and block->height() != state->top_height + 1) {
+    log_->warn(
+        "Only blocks with sequential heights could be inserted. Last block "
+        "height: {}, inserting: {}",
+        state->top_height,
+        block->height());
+    return false;
   }
 
-  auto h = block->height();
-  auto b = block->blob().hex();
+  auto height = std::to_string(block->height());
+  const auto &bytes = block->blob().blob();
+  const char *values[] = {height.c_str(),
+                          reinterpret_cast<const char *>(bytes.data())};
+  const int lengths[] = {0, static_cast<int>(bytes.size())};
+  const int formats[] = {0, 1};
+  auto query =
+      "INSERT INTO " + table_ + " (height, block_data) VALUES ($1, $2)";
 
-  soci::statement st = (sql.prepare << "INSERT INTO " << table_
-                                    << " (height, block_data) VALUES(:height, "
-                                       ":block_data)",
-                        soci::use(h),
-                        soci::use(b));
-  log_->debug("insert block {}: {}", h, b);
-  try {
-    st.execute(true);
-    return true;
-  } catch (const std::exception &e) {
-    log_->warn("Failed to insert block {}, reason {}", h, e.what());
+  log_->debug("insert block {}", block->height());
+  PgResult result(PQexecParams(connection(sql),
+                               query.c_str(),
+                               2,
+                               nullptr,
+                               values,
+                               lengths,
+                               formats,
+                               0),
+                  &PQclear);
+  if (PQresultStatus(result.get()) != PGRES_COMMAND_OK) {
+    log_->warn("Failed to insert block {}, reason {}",
+               block->height(),
+               PQresultErrorMessage(result.get()));
+    // the table could have been modified by someone else
+    state_ = boost::none;
     return false;
   }
+  state_ = TableState{block->height(), state->size + 1};
+  return true;
 }
 
 boost::optional<std::shared_ptr<const shared_model::interface::Block>>
 PostgresBlockStorage::fetch(
     shared_model::interface::types::HeightType height) const {
-  using T = boost::tuple<std::string>;
   soci::session sql(*pool_wrapper_->connection_pool_);
-  auto result = execute<T>([&] {
-    return (sql.prepare << "SELECT block_data FROM " << table_
-                        << " WHERE height = :height",
-            soci::use(height));
-  });
-  return flatMapValue<
-      boost::optional<std::shared_ptr<const shared_model::interface::Block>>>(
-      result, [&](auto &block_data) {
-        log_->debug("fetched: {}", block_data);
-        auto byte_block = iroha::hexstringToBytestring(block_data);
-        if (not byte_block) {
-          return boost::optional<
-              std::shared_ptr<const shared_model::interface::Block>>(
-              boost::none);
-        }
-
-        iroha::protocol::Block_v1 b1;
-        b1.ParseFromString(*byte_block);
-        iroha::protocol::Block block;
-        *block.mutable_block_v1() = b1;
-        return block_factory_->createBlock(std::move(block))
-            .match(
-                [&](auto &&v) {
-                  return boost::make_optional(
-                      std::shared_ptr<const shared_model::interface::Block>(
-                          std::move(v.value)));
-                },
-                [&](const auto &e)
-                    -> boost::optional<
-                        std::shared_ptr<const shared_model::interface::Block>> {
-                  log_->error("Could not build block at height {}: {}",
-                              height,
-                              e.error);
-                  return boost::none;
-                });
-      });
+  auto result = selectBinary(
+      sql,
+      "SELECT block_data FROM " + table_ + " WHERE height = $1",
+      {std::to_string(height)},
+      log_);
+  if (not result or PQntuples(result->get()) == 0) {
+    return boost::none;
+  }
+  return deserialize(height,
+                     PQgetvalue(result->get(), 0, 0),
+                     PQgetlength(result->get(), 0, 0));
+}
+
+boost::optional<std::shared_ptr<const shared_model::interface::Block>>
+PostgresBlockStorage::deserialize(
+    shared_model::interface::types::HeightType height,
+    const char *data,
+    size_t size) const {
+  auto arena = std::make_shared<google::protobuf::Arena>();
+  auto *block =
+      google::protobuf::Arena::CreateMessage<iroha::protocol::Block>(
+          arena.get());
+  if (not block->mutable_block_v1()->ParseFromArray(
+          data, static_cast<int>(size))) {
+    log_->error("Could not parse block at height {}", height);
+    return boost::none;
+  }
+  return block_factory_->createBlock(std::move(arena), *block)
+      .match(
+          [&](auto &&v) {
+            return boost::make_optional(
+                std::shared_ptr<const shared_model::interface::Block>(
+                    std::move(v.value)));
+          },
+          [&](const auto &e)
+              -> boost::optional<
+                  std::shared_ptr<const shared_model::interface::Block>> {
+            log_->error(
+                "Could not build block at height {}: {}", height, e.error);
+            return boost::none;
+          });
+}
+
+boost::optional<PostgresBlockStorage::TableState>
+PostgresBlockStorage::loadState(soci::session &sql) const {
+  if (not state_) {
+    shared_model::interface::types::HeightType top_height = 0;
+    shared_model::interface::types::HeightType size = 0;
+    try {
+      sql << "SELECT COALESCE(MAX(height), 0), COUNT(*) FROM " << table_,
+          soci::into(top_height), soci::into(size);
+      state_ = TableState{top_height, static_cast<size_t>(size)};
+    } catch (const std::exception &e) {
+      log_->error("Failed to load state of {} table: {}", table_, e.what());
+    }
+  }
+  return state_;
 }
 
 size_t PostgresBlockStorage::size() const {
-  using T = boost::tuple<shared_model::interface::types::HeightType>;
   soci::session sql(*pool_wrapper_->connection_pool_);
-  auto result = execute<T>(
-      [&] { return (sql.prepare << "SELECT COUNT(*) FROM " << table_); });
-  return flatMapValue<
-             boost::optional<shared_model::interface::types::HeightType>>(
-             result, [](auto &count) { return boost::make_optional(count); })
-      .value_or(0);
+  std::lock_guard<std::mutex> lock(state_mutex_);
+  auto state = loadState(sql);
+  return state ? state->size : 0;
 }
 
 void PostgresBlockStorage::clear() {
   soci::session sql(*pool_wrapper_->connection_pool_);
+  std::lock_guard<std::mutex> lock(state_mutex_);
   soci::statement st = (sql.prepare << "TRUNCATE " << table_);
   try {
     st.execute(true);
+    state_ = TableState{0, 0};
   } catch (const std::exception &e) {
     log_->warn("Failed to clear {} table, reason {}", table_, e.what());
+    state_ = boost::none;
   }
 }
 
 void PostgresBlockStorage::forEach(
     iroha::ametsuchi::BlockStorage::FunctionType function) const {
-  using T = boost::tuple<shared_model::interface::types::HeightType>;
-  soci::session sql(*pool_wrapper_->connection_pool_);
-  // TODO: IR-577 Add caching if it will gain a performance boost
-  // luckychess 29.06.2019
-  auto result_min = execute<T>(
-      [&] { return (sql.prepare << "SELECT MIN(height) FROM " << table_); });
-  auto min =
-      flatMapValue<boost::optional<shared_model::interface::types::HeightType>>(
-          result_min, [](auto &min) { return boost::make_optional(min); })
-          .value_or(0);
-  auto result_max = execute<T>(
-      [&] { return (sql.prepare << "SELECT MAX(height) FROM " << table_); });
-  auto max =
-      flatMapValue<boost::optional<shared_model::interface::types::HeightType>>(
-          result_max, [](auto &max) { return boost::make_optional(max); })
-          .value_or(0);
-  while (min <= max) {
-    function(*fetch(min));
-    ++min;
+  boost::optional<TableState> state;
+  {
+    soci::session sql(*pool_wrapper_->connection_pool_);
+    std::lock_guard<std::mutex> lock(state_mutex_);
+    state = loadState(sql);
+  }
+  if (not state) {
+    log_->error("Failed to read blocks from {}", table_);
+    return;
+  }
+  if (state->size == 0) {
+    return;
+  }
+  if (not forRange(state->top_height - state->size + 1,
+                   state->top_height,
+                   [&function](auto block) {
+                     function(std::move(block));
+                     return true;
+                   })) {
+    log_->error("Failed to read blocks from {}", table_);
   }
 }
 
-template <typename T, typename F>
-boost::optional<soci::rowset<T>> PostgresBlockStorage::execute(F &&f) const {
-  try {
-    return soci::rowset<T>{std::forward<F>(f)()};
-  } catch (const std::exception &e) {
-    log_->error("Failed to execute query: {}", e.what());
-    return boost::none;
+bool PostgresBlockStorage::forRange(
+    shared_model::interface::types::HeightType from,
+    shared_model::interface::types::HeightType to,
+    RangeFunctionType function) const {
+  soci::session sql(*pool_wrapper_->connection_pool_);
+  // height is selected as text, since the result is in binary format
+  const auto query = "SELECT height::text, block_data FROM " + table_
+      + " WHERE height >= $1 AND height <= $2 ORDER BY height LIMIT $3";
+  boost::optional<shared_model::interface::types::HeightType> last_height;
+  // blocks are read in batches, so that only a bounded number of them is
+  // kept in memory, and the next batch starts after the last read block
+  while (from <= to) {
+    auto result = selectBinary(sql,
+                               query,
+                               {std::to_string(from),
+                                std::to_string(to),
+                                std::to_string(kFetchBatchSize)},
+                               log_);
+    if (not result) {
+      return false;
+    }
+
+    auto fetched = PQntuples(result->get());
+    for (int row = 0; row < fetched; ++row) {
+      shared_model::interface::types::HeightType height =
+          std::stoull(std::string(PQgetvalue(result->get(), row, 0),
+                                  PQgetlength(result->get(), row, 0)));
+      if (last_height and height != *last_height + 1) {
+        log_->error("Block with height {} is missing in {}",
+                    *last_height + 1,
+                    table_);
+        return false;
+      }
+      last_height = height;
+      auto block = this->deserialize(height,
+                                     PQgetvalue(result->get(), row, 1),
+                                     PQgetlength(result->get(), row, 1));
+      if (not block) {
+        return false;
+      }
+      if (not function(std::move(*block))) {
+        return true;
+      }
+    }
+    if (static_cast<size_t>(fetched) < kFetchBatchSize) {
+      break;
+    }
+    from = *last_height + 1;
   }
+  return true;
 }
 
 PostgresTemporaryBlockStorage::PostgresTemporaryBlockStorage(
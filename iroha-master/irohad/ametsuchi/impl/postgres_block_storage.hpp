@@ -8,6 +8,8 @@
 
 #include "ametsuchi/block_storage.hpp"
 
+#include <mutex>
+
 #include "ametsuchi/impl/pool_wrapper.hpp"
 #include "ametsuchi/impl/soci_utils.hpp"
 #include "backend/protobuf/block.hpp"
@@ -38,19 +40,51 @@ namespace iroha {
 
       void forEach(FunctionType function) const override;
 
+      bool forRange(shared_model::interface::types::HeightType from,
+                    shared_model::interface::types::HeightType to,
+                    RangeFunctionType function) const override;
+
+      /// Number of blocks read by a single query while iterating a range
+      static constexpr size_t kFetchBatchSize = 64;
+
      private:
       /**
-       * Executes given lambda of type F, catches exceptions if any, logs the
-       * message, and returns an optional rowset<T>
+       * Create block from its stored representation
+       * @param height - height of the block, used for logging
+       * @param data - serialized block
+       * @param size - size of the serialized block in bytes
+       * @return block or boost::none if it is malformed
+       */
+      boost::optional<std::shared_ptr<const shared_model::interface::Block>>
+      deserialize(shared_model::interface::types::HeightType height,
+                  const char *data,
+                  size_t size) const;
+
+      /// Height of the top block and the number of blocks in the table
+      struct TableState {
+        shared_model::interface::types::HeightType top_height;
+        size_t size;
+      };
+
+      /**
+       * Get the state of the table, load it from the database if it is not
+       * known yet. Must be called with state_mutex_ locked
+       * @param sql - session to load the state with
+       * @return state of the table or boost::none if it could not be loaded
        */
-      template <typename T, typename F>
-      boost::optional<soci::rowset<T>> execute(F &&f) const;
+      boost::optional<TableState> loadState(soci::session &sql) const;
 
      protected:
       std::shared_ptr<PoolWrapper> pool_wrapper_;
       std::shared_ptr<BlockTransportFactory> block_factory_;
       std::string table_;
       logger::LoggerPtr log_;
+
+     private:
+      /// State of the table kept in sync with inserts, so that it is not
+      /// queried on each of them. boost::none means it has to be reloaded
+      mutable boost::optional<TableState> state_;
+      mutable std::mutex state_mutex_;
     };
 
     class PostgresTemporaryBlockStorage : public PostgresBlockStorage {
@@ -9,6 +9,8 @@
 
 using namespace iroha::ametsuchi;
 
+constexpr size_t PostgresBlockStorageFactory::kMigrationBatchSize;
+
 PostgresBlockStorageFactory::PostgresBlockStorageFactory(
     std::shared_ptr<PoolWrapper> pool_wrapper,
     std::shared_ptr<shared_model::proto::ProtoBlockFactory> block_factory,
@@ -36,12 +38,57 @@ PostgresBlockStorageFactory::createTable(soci::session &sql,
                                          const std::string &table) {
   soci::statement st =
       (sql.prepare << "CREATE TABLE IF NOT EXISTS " << table
-                   << "(height bigint PRIMARY KEY, block_data text not null)");
+                   << "(height bigint PRIMARY KEY, block_data bytea not null)");
   try {
     st.execute(true);
-    return {};
   } catch (const std::exception &e) {
     return expected::makeError("Unable to create block store: "
                                + std::string(e.what()));
   }
+  return migrateTable(sql, table);
+}
+
+iroha::expected::Result<void, std::string>
+PostgresBlockStorageFactory::migrateTable(soci::session &sql,
+                                          const std::string &table) {
+  try {
+    std::string type;
+    sql << "SELECT data_type FROM information_schema.columns "
+           "WHERE table_schema = current_schema() "
+           "AND table_name = lower(:table) AND column_name = 'block_data'",
+        soci::use(table), soci::into(type);
+    if (type != "text") {
+      return {};
+    }
+
+    // blocks are decoded into a new column, which replaces the old one when
+    // all of them are converted
+    sql << "ALTER TABLE " << table
+        << " ADD COLUMN IF NOT EXISTS block_bytes bytea";
+    auto batch_size = kMigrationBatchSize;
+    while (true) {
+      soci::statement st =
+          (sql.prepare << "UPDATE " << table
+                       << " SET block_bytes = decode(block_data, 'hex') "
+                          "WHERE height IN (SELECT height FROM "
+                       << table
+                       << " WHERE block_bytes IS NULL LIMIT :limit)",
+           soci::use(batch_size));
+      st.execute(true);
+      if (st.get_affected_rows() == 0) {
+        break;
+      }
+    }
+
+    soci::transaction tr(sql);
+    sql << "ALTER TABLE " << table << " DROP COLUMN block_data";
+    sql << "ALTER TABLE " << table
+        << " RENAME COLUMN block_bytes TO block_data";
+    sql << "ALTER TABLE " << table << " ALTER COLUMN block_data SET NOT NULL";
+    tr.commit();
+    return {};
+  } catch (const std::exception &e) {
+    return expected::makeError("Unable to migrate block store: "
+                               + std::string(e.what()));
+  }
 }
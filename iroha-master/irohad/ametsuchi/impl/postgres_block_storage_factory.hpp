@@ -22,9 +22,32 @@ namespace iroha {
           logger::LoggerPtr log);
       std::unique_ptr<BlockStorage> create() override;
 
+      /**
+       * Create table for blocks if it does not exist, migrate it to the
+       * current format otherwise
+       * @param sql - session to execute statements with
+       * @param table - name of the table
+       * @return error message in case of failure
+       */
       static iroha::expected::Result<void, std::string> createTable(
           soci::session &sql, const std::string &table);
 
+      /**
+       * Convert table with blocks stored as hex strings to the table with
+       * raw bytea blocks. Blocks are converted in batches, each in its own
+       * transaction, so the table is not locked for the whole migration and
+       * an interrupted migration is resumed on the next call. Does nothing
+       * if the table is already converted
+       * @param sql - session to execute statements with
+       * @param table - name of the table
+       * @return error message in case of failure
+       */
+      static iroha::expected::Result<void, std::string> migrateTable(
+          soci::session &sql, const std::string &table);
+
+      /// Number of blocks converted in a single transaction by migrateTable
+      static constexpr size_t kMigrationBatchSize = 1000;
+
      private:
       std::shared_ptr<PoolWrapper> pool_wrapper_;
       std::shared_ptr<shared_model::proto::ProtoBlockFactory> block_factory_;
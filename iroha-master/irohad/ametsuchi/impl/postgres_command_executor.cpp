@@ -519,9 +519,9 @@ namespace iroha {
           has_signatory AS (SELECT * FROM signatory WHERE public_key = $4),
           insert_account AS
           (
-              INSERT INTO account(account_id, domain_id, quorum, data)
+              INSERT INTO account(account_id, domain_id, quorum)
               (
-                  SELECT $2, $3, 1, '{}' WHERE (EXISTS
+                  SELECT $2, $3, 1 WHERE (EXISTS
                       (SELECT * FROM insert_signatory) OR EXISTS
                       (SELECT * FROM has_signatory)
                   ) AND EXISTS (SELECT * FROM get_domain_default_role)
@@ -707,10 +707,13 @@ namespace iroha {
           WITH %s
               inserted AS
               (
-                  UPDATE account SET data = jsonb_set(
-                  CASE WHEN data ?$1 THEN data ELSE
-                  jsonb_set(data, array[$1], '{}') END,
-                  array[$1, $3], $4::jsonb) WHERE account_id=$2 %s
+                  INSERT INTO account_has_detail(account_id, writer, key, value)
+                  (
+                      SELECT $2, $1, $3, $4 WHERE EXISTS
+                          (SELECT * FROM account WHERE account_id=$2) %s
+                  )
+                  ON CONFLICT (account_id, writer, key)
+                  DO UPDATE SET value = EXCLUDED.value
                   RETURNING (1)
               )
               SELECT CASE WHEN EXISTS (SELECT * FROM inserted) THEN 0
@@ -856,30 +859,26 @@ namespace iroha {
                   FROM account
                   WHERE
                     account_id = $2
-                    AND CASE
-                      WHEN data ? $1 AND data->$1 ?$3
-                        THEN
-                          CASE
-                            WHEN $5 IS NOT NULL THEN data->$1->$3 = $5::jsonb
-                            ELSE FALSE
-                          END
-                      ELSE TRUE
-                    END
+                    AND COALESCE(
+                      (
+                        SELECT $5 IS NOT NULL AND value = $5
+                        FROM account_has_detail
+                        WHERE account_id = $2 AND writer = $1 AND key = $3
+                      ),
+                      TRUE
+                    )
               ),
               inserted AS
               (
-                  UPDATE account
-                  SET data = jsonb_set(
-                    CASE
-                      WHEN data ? $1 THEN data
-                      ELSE jsonb_set(data, array[$1], '{}')
-                    END,
-                    array[$1, $3], $4::jsonb
+                  INSERT INTO account_has_detail(account_id, writer, key, value)
+                  (
+                      SELECT $2, $1, $3, $4
+                      WHERE
+                        EXISTS (SELECT * FROM old_value)
+                        %s
                   )
-                  WHERE
-                    EXISTS (SELECT * FROM old_value)
-                    AND account_id = $2
-                    %s
+                  ON CONFLICT (account_id, writer, key)
+                  DO UPDATE SET value = EXCLUDED.value
                   RETURNING (1)
               )
               SELECT CASE
@@ -1226,13 +1225,11 @@ namespace iroha {
         // When creator is not known, it is genesis block
         creator_account_id_ = "genesis";
       }
-      std::string val = "\"" + value + "\"";
-
       auto cmd = boost::format("EXECUTE %1% ('%2%', '%3%', '%4%', '%5%')");
 
       appendCommandName("setAccountDetail", cmd, do_validation_);
 
-      cmd = (cmd % creator_account_id_ % account_id % key % val);
+      cmd = (cmd % creator_account_id_ % account_id % key % value);
 
       auto str_args = [&account_id, &key, &value] {
         return getQueryArgsStringBuilder()
@@ -1335,24 +1332,22 @@ namespace iroha {
 
       appendCommandName("compareAndSetAccountDetail", cmd, do_validation_);
 
-      std::string new_json_value = "\"" + value + "\"";
-      std::string expected_json_value = "NULL";
+      std::string expected_value = "NULL";
 
       if (old_value) {
-        expected_json_value = "'\"" + old_value.get() + "\"'";
+        expected_value = "'" + old_value.get() + "'";
       }
 
-      cmd = (cmd % creator_account_id_ % account_id % key % new_json_value
-             % expected_json_value % getDomainFromName(creator_account_id_)
+      cmd = (cmd % creator_account_id_ % account_id % key % value
+             % expected_value % getDomainFromName(creator_account_id_)
              % getDomainFromName(account_id));
 
-      auto str_args = [&account_id, &key, &new_json_value, &old_value] {
+      auto str_args = [&account_id, &key, &value, &old_value] {
         return getQueryArgsStringBuilder()
             .append("account_id", account_id)
             .append("key", key)
-            .append("value", new_json_value)
-            .append("old_value",
-                    old_value ? "\"" + old_value.get() + "\"" : "NULL")
+            .append("value", value)
+            .append("old_value", old_value ? old_value.get() : "NULL")
             .finalize();
       };
 
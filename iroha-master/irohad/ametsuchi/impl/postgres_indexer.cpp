@@ -24,6 +24,16 @@ void PostgresIndexer::txHashPosition(const HashType &hash,
       (base % hash.hex() % position.height % position.index).str());
 }
 
+void PostgresIndexer::txBlobPosition(const BlobType &tx_blob,
+                                     TxPosition position) {
+  boost::format base(
+      "INSERT INTO tx_data_by_position"
+      "(height, index, data) VALUES "
+      "('%s', '%s', decode('%s', 'hex')) ON CONFLICT DO NOTHING;\n");
+  statements_.append(
+      (base % position.height % position.index % tx_blob.hex()).str());
+}
+
 void PostgresIndexer::txHashStatus(const HashType &rejected_tx_hash,
                                    bool is_committed) {
   boost::format base(
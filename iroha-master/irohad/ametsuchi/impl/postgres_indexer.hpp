@@ -22,6 +22,10 @@ namespace iroha {
       void txHashPosition(const shared_model::interface::types::HashType &hash,
                           TxPosition position) override;
 
+      void txBlobPosition(
+          const shared_model::interface::types::BlobType &tx_blob,
+          TxPosition position) override;
+
       void committedTxHash(const shared_model::interface::types::HashType
                                &committed_tx_hash) override;
 
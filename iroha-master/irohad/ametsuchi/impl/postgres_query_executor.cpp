@@ -7,7 +7,8 @@
 
 #include <boost/range/adaptor/transformed.hpp>
 #include <boost/range/size.hpp>
-#include "ametsuchi/specific_query_executor.hpp"
+#include "ametsuchi/impl/postgres_specific_query_executor.hpp"
+#include "ametsuchi/impl/soci_utils.hpp"
 #include "cryptography/public_key.hpp"
 #include "interfaces/iroha_internal/query_response_factory.hpp"
 #include "interfaces/queries/blocks_query.hpp"
@@ -44,16 +45,12 @@ namespace iroha {
       // not using bool since it is not supported by SOCI
       boost::optional<uint8_t> signatories_valid;
 
-      auto qry = R"(
-        SELECT count(public_key) = 1
-        FROM account_has_signatory
-        WHERE account_id = :account_id AND public_key = :pk
-        )";
+      // the arguments come from the client and are not validated yet
+      auto qry = executeStatementSql(
+          "validateSignatures", query.creatorAccountId(), keys);
 
       try {
-        *sql_ << qry, soci::into(signatories_valid),
-            soci::use(query.creatorAccountId(), "account_id"),
-            soci::use(keys, "pk");
+        *sql_ << qry, soci::into(signatories_valid);
       } catch (const std::exception &e) {
         log_->error("{}", e.what());
         return false;
@@ -96,5 +93,15 @@ namespace iroha {
       return true;
     }
 
+    void PostgresQueryExecutor::prepareStatements(soci::session &sql) {
+      sql << R"(
+        PREPARE validateSignatures (text, text) AS
+        SELECT count(public_key) = 1
+        FROM account_has_signatory
+        WHERE account_id = $1 AND public_key = $2
+        )";
+      PostgresSpecificQueryExecutor::prepareStatements(sql);
+    }
+
   }  // namespace ametsuchi
 }  // namespace iroha
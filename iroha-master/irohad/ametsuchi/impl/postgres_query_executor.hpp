@@ -38,6 +38,13 @@ namespace iroha {
       bool validate(const shared_model::interface::BlocksQuery &query,
                     const bool validate_signatories) override;
 
+      /**
+       * Prepare statements of query validation and of all the queries in the
+       * session, so that they are parsed and planned once per connection
+       * @param sql - session to prepare statements in
+       */
+      static void prepareStatements(soci::session &sql);
+
      private:
       template <class Q>
       bool validateSignatures(const Q &query);
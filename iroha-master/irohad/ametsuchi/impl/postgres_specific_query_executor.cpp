@@ -13,9 +13,12 @@
 #include <boost/range/algorithm/transform.hpp>
 #include <boost/range/irange.hpp>
 #include "ametsuchi/block_storage.hpp"
+#include "ametsuchi/impl/account_permission_cache.hpp"
 #include "ametsuchi/impl/soci_utils.hpp"
 #include "backend/plain/peer.hpp"
+#include "backend/protobuf/transaction.hpp"
 #include "common/byteutils.hpp"
+#include "common/hexutils.hpp"
 #include "interfaces/common_objects/amount.hpp"
 #include "interfaces/iroha_internal/block.hpp"
 #include "interfaces/permission_to_string.hpp"
@@ -53,77 +56,6 @@ namespace {
     return res.at(1);
   }
 
-  std::string getAccountRolePermissionCheckSql(
-      shared_model::interface::permissions::Role permission,
-      const std::string &account_alias = "role_account_id") {
-    const auto perm_str =
-        shared_model::interface::RolePermissionSet({permission}).toBitstring();
-    const auto bits = shared_model::interface::RolePermissionSet::size();
-    // TODO 14.09.18 andrei: IR-1708 Load SQL from separate files
-    std::string query = (boost::format(R"(
-          SELECT (COALESCE(bit_or(rp.permission), '0'::bit(%1%))
-          & '%2%') = '%2%' AS perm FROM role_has_permissions AS rp
-              JOIN account_has_roles AS ar on ar.role_id = rp.role_id
-              WHERE ar.account_id = :%3%)")
-                         % bits % perm_str % account_alias)
-                            .str();
-    return query;
-  }
-
-  /**
-   * Generate an SQL subquery which checks if creator has corresponding
-   * permissions for target account
-   * It verifies individual, domain, and global permissions, and returns true if
-   * any of listed permissions is present
-   */
-  auto hasQueryPermission(
-      const shared_model::interface::types::AccountIdType &creator,
-      const shared_model::interface::types::AccountIdType &target_account,
-      Role indiv_permission_id,
-      Role all_permission_id,
-      Role domain_permission_id) {
-    const auto bits = shared_model::interface::RolePermissionSet::size();
-    const auto perm_str =
-        shared_model::interface::RolePermissionSet({indiv_permission_id})
-            .toBitstring();
-    const auto all_perm_str =
-        shared_model::interface::RolePermissionSet({all_permission_id})
-            .toBitstring();
-    const auto domain_perm_str =
-        shared_model::interface::RolePermissionSet({domain_permission_id})
-            .toBitstring();
-
-    boost::format cmd(R"(
-    WITH
-        has_indiv_perm AS (
-          SELECT (COALESCE(bit_or(rp.permission), '0'::bit(%1%))
-          & '%3%') = '%3%' FROM role_has_permissions AS rp
-              JOIN account_has_roles AS ar on ar.role_id = rp.role_id
-              WHERE ar.account_id = '%2%'
-        ),
-        has_all_perm AS (
-          SELECT (COALESCE(bit_or(rp.permission), '0'::bit(%1%))
-          & '%4%') = '%4%' FROM role_has_permissions AS rp
-              JOIN account_has_roles AS ar on ar.role_id = rp.role_id
-              WHERE ar.account_id = '%2%'
-        ),
-        has_domain_perm AS (
-          SELECT (COALESCE(bit_or(rp.permission), '0'::bit(%1%))
-          & '%5%') = '%5%' FROM role_has_permissions AS rp
-              JOIN account_has_roles AS ar on ar.role_id = rp.role_id
-              WHERE ar.account_id = '%2%'
-        )
-    SELECT ('%2%' = '%6%' AND (SELECT * FROM has_indiv_perm))
-        OR (SELECT * FROM has_all_perm)
-        OR ('%7%' = '%8%' AND (SELECT * FROM has_domain_perm)) AS perm
-    )");
-
-    return (cmd % bits % creator % perm_str % all_perm_str % domain_perm_str
-            % target_account % getDomainFromName(creator)
-            % getDomainFromName(target_account))
-        .str();
-  }
-
   /// Query result is a tuple of optionals, since there could be no entry
   template <typename... Value>
   using QueryType = boost::tuple<boost::optional<Value>...>;
@@ -151,6 +83,29 @@ namespace {
 
   static const std::string kEmptyDetailsResponse{"{}"};
 
+  /**
+   * Deserialize a transaction stored in the transaction index
+   * @param data - serialized transaction in the hex output format of bytea,
+   * i.e. prefixed with \x
+   * @return the transaction or nullptr if it is not available
+   */
+  std::unique_ptr<shared_model::interface::Transaction> transactionFromBytea(
+      const std::string &data) {
+    static const std::string kHexPrefix{"\\x"};
+    if (data.compare(0, kHexPrefix.size(), kHexPrefix) != 0) {
+      return nullptr;
+    }
+    auto bytes = iroha::hexstringToBytestring(data.substr(kHexPrefix.size()));
+    if (not bytes) {
+      return nullptr;
+    }
+    iroha::protocol::Transaction tx;
+    if (not tx.ParseFromString(*bytes)) {
+      return nullptr;
+    }
+    return std::make_unique<shared_model::proto::Transaction>(std::move(tx));
+  }
+
   template <typename T>
   auto resultWithoutNulls(T range) {
     return range | boost::adaptors::transformed([](auto &&t) {
@@ -174,12 +129,14 @@ namespace iroha {
             response_factory,
         std::shared_ptr<shared_model::interface::PermissionToString>
             perm_converter,
+        std::shared_ptr<AccountPermissionCache> permission_cache,
         logger::LoggerPtr log)
         : sql_(sql),
           block_store_(block_store),
           pending_txs_storage_(std::move(pending_txs_storage)),
           query_response_factory_{std::move(response_factory)},
           perm_converter_(std::move(perm_converter)),
+          permission_cache_(std::move(permission_cache)),
           log_(std::move(log)) {}
 
     QueryExecutorResult PostgresSpecificQueryExecutor::execute(
@@ -210,6 +167,55 @@ namespace iroha {
       return result;
     }
 
+    iroha::expected::Result<
+        std::vector<std::unique_ptr<shared_model::interface::Transaction>>,
+        std::string>
+    PostgresSpecificQueryExecutor::getTransactionsByPositions(
+        const TxPositions &positions) {
+      std::vector<std::unique_ptr<shared_model::interface::Transaction>> result(
+          positions.size());
+      // block height -> (positions in result, indexes of txs in the block)
+      std::map<uint64_t, std::pair<std::vector<size_t>, std::vector<uint64_t>>>
+          not_indexed;
+      size_t slot = 0;
+      for (const auto &position : positions) {
+        if (auto tx = transactionFromBytea(position.second)) {
+          result[slot] = std::move(tx);
+        } else {
+          // transactions committed before the index was introduced
+          auto &block = not_indexed[position.first.first];
+          block.first.push_back(slot);
+          block.second.push_back(position.first.second);
+        }
+        ++slot;
+      }
+
+      for (auto &block : not_indexed) {
+        auto &slots = block.second.first;
+        auto &indexes = block.second.second;
+        auto txs = this->getTransactionsFromBlock(
+            block.first,
+            [&indexes](auto size) {
+              return indexes | boost::adaptors::filtered([size](auto index) {
+                       return index < size;
+                     });
+            },
+            [](auto &) { return true; });
+        if (txs.size() != slots.size()) {
+          return expected::makeError(
+              (boost::format("could not get transactions of block %d, "
+                             "got %d of %d")
+               % block.first % txs.size() % slots.size())
+                  .str());
+        }
+        for (size_t i = 0; i < slots.size(); ++i) {
+          result[slots[i]] = std::move(txs[i]);
+        }
+      }
+
+      return expected::makeValue(std::move(result));
+    }
+
     template <typename QueryTuple,
               typename PermissionTuple,
               typename QueryExecutor,
@@ -252,21 +258,47 @@ namespace iroha {
       }
     }
 
+    boost::optional<shared_model::interface::RolePermissionSet>
+    PostgresSpecificQueryExecutor::getAccountPermissions(
+        const shared_model::interface::types::AccountIdType &account_id) const {
+      return permission_cache_->get(account_id, [this, &account_id] {
+        std::string permissions;
+        try {
+          sql_ << executeStatementSql("getAccountPermissions", account_id),
+              soci::into(permissions);
+        } catch (const std::exception &e) {
+          log_->error("Failed to get permissions of {}: {}",
+                      account_id,
+                      e.what());
+          return boost::optional<shared_model::interface::RolePermissionSet>{};
+        }
+        return boost::make_optional(
+            shared_model::interface::RolePermissionSet(permissions));
+      });
+    }
+
     bool PostgresSpecificQueryExecutor::hasAccountRolePermission(
         shared_model::interface::permissions::Role permission,
         const std::string &account_id) const {
-      using T = boost::tuple<int>;
-      boost::format cmd(R"(%s)");
-      try {
-        soci::rowset<T> st =
-            (sql_.prepare
-                 << (cmd % getAccountRolePermissionCheckSql(permission)).str(),
-             soci::use(account_id, "role_account_id"));
-        return st.begin()->get<0>();
-      } catch (const std::exception &e) {
-        log_->error("Failed to validate query: {}", e.what());
+      auto permissions = getAccountPermissions(account_id);
+      return permissions and permissions->isSet(permission);
+    }
+
+    bool PostgresSpecificQueryExecutor::hasQueryPermission(
+        const shared_model::interface::types::AccountIdType &creator,
+        const shared_model::interface::types::AccountIdType &target_account,
+        Role indiv_permission_id,
+        Role all_permission_id,
+        Role domain_permission_id) const {
+      auto permissions = getAccountPermissions(creator);
+      if (not permissions) {
         return false;
       }
+      return (creator == target_account
+              and permissions->isSet(indiv_permission_id))
+          or permissions->isSet(all_permission_id)
+          or (getDomainFromName(creator) == getDomainFromName(target_account)
+              and permissions->isSet(domain_permission_id));
     }
 
     void PostgresSpecificQueryExecutor::setCreatorId(
@@ -315,90 +347,60 @@ namespace iroha {
           error_type, error, error_code, query_hash_);
     }
 
-    template <typename Query,
-              typename QueryChecker,
-              typename QueryApplier,
-              typename... Permissions>
+    template <typename Query, typename QueryChecker, typename... Permissions>
     QueryExecutorResult PostgresSpecificQueryExecutor::executeTransactionsQuery(
         const Query &q,
         QueryChecker &&qry_checker,
-        const std::string &related_txs,
-        QueryApplier applier,
+        const std::string &statement,
+        std::vector<std::string> arguments,
         Permissions... perms) {
       using QueryTuple = QueryType<shared_model::interface::types::HeightType,
                                    uint64_t,
-                                   uint64_t>;
+                                   uint64_t,
+                                   std::string>;
       using PermissionTuple = boost::tuple<int>;
       const auto &pagination_info = q.paginationMeta();
       auto first_hash = pagination_info.firstTxHash();
       // retrieve one extra transaction to populate next_hash
       auto query_size = pagination_info.pageSize() + 1u;
 
-      auto base = boost::format(R"(WITH has_perms AS (%s),
-      my_txs AS (%s),
-      first_hash AS (%s),
-      total_size AS (
-        SELECT COUNT(*) FROM my_txs
-      ),
-      t AS (
-        SELECT my_txs.height, my_txs.index
-        FROM my_txs JOIN
-        first_hash ON my_txs.height > first_hash.height
-        OR (my_txs.height = first_hash.height AND
-            my_txs.index >= first_hash.index)
-        LIMIT :page_size
-      )
-      SELECT height, index, count, perm FROM t
-      RIGHT OUTER JOIN has_perms ON TRUE
-      JOIN total_size ON TRUE
-      )");
-
-      // select tx with specified hash
-      auto first_by_hash = R"(SELECT height, index FROM position_by_hash
-      WHERE hash = :hash LIMIT 1)";
-
-      // select first ever tx
-      auto first_tx = R"(SELECT height, index FROM position_by_hash
-      ORDER BY height, index ASC LIMIT 1)";
-
-      auto cmd = base % hasQueryPermission(creator_id_, q.accountId(), perms...)
-          % related_txs;
+      arguments.insert(
+          arguments.begin(),
+          sqlValue(hasQueryPermission(creator_id_, q.accountId(), perms...)));
+      arguments.push_back(sqlValue(query_size));
       if (first_hash) {
-        cmd = base % first_by_hash;
-      } else {
-        cmd = base % first_tx;
+        arguments.push_back(sqlValue(first_hash->hex()));
       }
-
-      auto query = cmd.str();
+      auto query = executeStatementSql(
+          first_hash ? statement + "FromHash" : statement, arguments);
 
       return executeQuery<QueryTuple, PermissionTuple>(
-          applier(query),
+          [&] { return (sql_.prepare << query); },
           [&](auto range, auto &) {
             auto range_without_nulls = resultWithoutNulls(std::move(range));
             uint64_t total_size = 0;
             if (not boost::empty(range_without_nulls)) {
               total_size = boost::get<2>(*range_without_nulls.begin());
             }
-            std::map<uint64_t, std::vector<uint64_t>> index;
-            // unpack results to get map from block height to index of tx in
-            // a block
+            TxPositions positions;
+            // unpack results to get map from position of tx in the ledger to
+            // its serialized form
             for (const auto &t : range_without_nulls) {
-              apply(t, [&index](auto &height, auto &idx, auto &) {
-                index[height].push_back(idx);
-              });
+              apply(t,
+                    [&positions](
+                        auto &height, auto &idx, auto &, auto &data) {
+                      positions.emplace(std::make_pair(height, idx), data);
+                    });
             }
 
-            std::vector<std::unique_ptr<shared_model::interface::Transaction>>
-                response_txs;
-            // get transactions corresponding to indexes
-            for (auto &block : index) {
-              auto txs = this->getTransactionsFromBlock(
-                  block.first,
-                  [&block](auto) { return block.second; },
-                  [](auto &) { return true; });
-              std::move(
-                  txs.begin(), txs.end(), std::back_inserter(response_txs));
+            auto txs_result = this->getTransactionsByPositions(positions);
+            if (auto error = expected::resultToOptionalError(txs_result)) {
+              return this->logAndReturnErrorResponse(
+                  QueryErrorType::kStatefulFailed, *error, 1);
             }
+            auto response_txs = std::move(
+                boost::get<expected::ValueOf<decltype(txs_result)>>(txs_result)
+                    .value);
 
             if (response_txs.empty()) {
               if (first_hash) {
@@ -451,23 +453,14 @@ namespace iroha {
                     std::string>;
       using PermissionTuple = boost::tuple<int>;
 
-      auto cmd = (boost::format(R"(WITH has_perms AS (%s),
-      t AS (
-          SELECT a.account_id, a.domain_id, a.quorum, a.data, ARRAY_AGG(ar.role_id) AS roles
-          FROM account AS a, account_has_roles AS ar
-          WHERE a.account_id = :target_account_id
-          AND ar.account_id = a.account_id
-          GROUP BY a.account_id
-      )
-      SELECT account_id, domain_id, quorum, data, roles, perm
-      FROM t RIGHT OUTER JOIN has_perms AS p ON TRUE
-      )")
-                  % hasQueryPermission(creator_id_,
-                                       q.accountId(),
-                                       Role::kGetMyAccount,
-                                       Role::kGetAllAccounts,
-                                       Role::kGetDomainAccounts))
-                     .str();
+      auto cmd = executeStatementSql(
+          "getAccount",
+          hasQueryPermission(creator_id_,
+                             q.accountId(),
+                             Role::kGetMyAccount,
+                             Role::kGetAllAccounts,
+                             Role::kGetDomainAccounts),
+          q.accountId());
 
       auto query_apply = [this](auto &account_id,
                                 auto &domain_id,
@@ -483,10 +476,7 @@ namespace iroha {
       };
 
       return executeQuery<QueryTuple, PermissionTuple>(
-          [&] {
-            return (sql_.prepare << cmd,
-                    soci::use(q.accountId(), "target_account_id"));
-          },
+          [&] { return (sql_.prepare << cmd); },
           [this, &q, &query_apply](auto range, auto &) {
             auto range_without_nulls = resultWithoutNulls(std::move(range));
             if (range_without_nulls.empty()) {
@@ -544,23 +534,17 @@ namespace iroha {
       using QueryTuple = QueryType<std::string>;
       using PermissionTuple = boost::tuple<int>;
 
-      auto cmd = (boost::format(R"(WITH has_perms AS (%s),
-      t AS (
-          SELECT public_key FROM account_has_signatory
-          WHERE account_id = :account_id
-      )
-      SELECT public_key, perm FROM t
-      RIGHT OUTER JOIN has_perms ON TRUE
-      )")
-                  % hasQueryPermission(creator_id_,
-                                       q.accountId(),
-                                       Role::kGetMySignatories,
-                                       Role::kGetAllSignatories,
-                                       Role::kGetDomainSignatories))
-                     .str();
+      auto cmd = executeStatementSql(
+          "getSignatories",
+          hasQueryPermission(creator_id_,
+                             q.accountId(),
+                             Role::kGetMySignatories,
+                             Role::kGetAllSignatories,
+                             Role::kGetDomainSignatories),
+          q.accountId());
 
       return executeQuery<QueryTuple, PermissionTuple>(
-          [&] { return (sql_.prepare << cmd, soci::use(q.accountId())); },
+          [&] { return (sql_.prepare << cmd); },
           [this, &q](auto range, auto &) {
             auto range_without_nulls = resultWithoutNulls(std::move(range));
             if (range_without_nulls.empty()) {
@@ -588,31 +572,6 @@ namespace iroha {
 
     QueryExecutorResult PostgresSpecificQueryExecutor::operator()(
         const shared_model::interface::GetAccountTransactions &q) {
-      std::string related_txs = R"(SELECT DISTINCT height, index
-      FROM tx_position_by_creator
-      WHERE creator_id = :account_id
-      ORDER BY height, index ASC)";
-
-      const auto &pagination_info = q.paginationMeta();
-      auto first_hash = pagination_info.firstTxHash();
-      // retrieve one extra transaction to populate next_hash
-      auto query_size = pagination_info.pageSize() + 1u;
-
-      auto apply_query = [&](const auto &query) {
-        return [&] {
-          if (first_hash) {
-            return (sql_.prepare << query,
-                    soci::use(q.accountId()),
-                    soci::use(first_hash->hex()),
-                    soci::use(query_size));
-          } else {
-            return (sql_.prepare << query,
-                    soci::use(q.accountId()),
-                    soci::use(query_size));
-          }
-        };
-      };
-
       auto check_query = [this](const auto &q) {
         if (this->existsInDb<int>(
                 "account", "account_id", "quorum", q.accountId())) {
@@ -624,8 +583,8 @@ namespace iroha {
 
       return executeTransactionsQuery(q,
                                       std::move(check_query),
-                                      related_txs,
-                                      apply_query,
+                                      "getAccountTransactions",
+                                      {sqlValue(q.accountId())},
                                       Role::kGetMyAccTxs,
                                       Role::kGetAllAccTxs,
                                       Role::kGetDomainAccTxs);
@@ -633,34 +592,24 @@ namespace iroha {
 
     QueryExecutorResult PostgresSpecificQueryExecutor::operator()(
         const shared_model::interface::GetTransactions &q) {
-      auto escape = [](auto &hash) { return "'" + hash.hex() + "'"; };
-      std::string hash_str = std::accumulate(
-          std::next(q.transactionHashes().begin()),
-          q.transactionHashes().end(),
-          escape(q.transactionHashes().front()),
-          [&escape](auto &acc, auto &val) { return acc + "," + escape(val); });
+      std::vector<std::string> hashes;
+      for (const auto &hash : q.transactionHashes()) {
+        hashes.push_back(hash.hex());
+      }
 
       using QueryTuple =
           QueryType<shared_model::interface::types::HeightType, std::string>;
       using PermissionTuple = boost::tuple<int, int>;
 
-      auto cmd =
-          (boost::format(R"(WITH has_my_perm AS (%s),
-      has_all_perm AS (%s),
-      t AS (
-          SELECT height, hash FROM position_by_hash WHERE hash IN (%s)
-      )
-      SELECT height, hash, has_my_perm.perm, has_all_perm.perm FROM t
-      RIGHT OUTER JOIN has_my_perm ON TRUE
-      RIGHT OUTER JOIN has_all_perm ON TRUE
-      )") % getAccountRolePermissionCheckSql(Role::kGetMyTxs, "account_id")
-           % getAccountRolePermissionCheckSql(Role::kGetAllTxs, "account_id")
-           % hash_str)
-              .str();
+      auto cmd = executeStatementSql(
+          "getTransactions",
+          hasAccountRolePermission(Role::kGetMyTxs, creator_id_),
+          hasAccountRolePermission(Role::kGetAllTxs, creator_id_),
+          hashes);
 
       return executeQuery<QueryTuple, PermissionTuple>(
           [&] {
-            return (sql_.prepare << cmd, soci::use(creator_id_, "account_id"));
+            return (sql_.prepare << cmd);
           },
           [&](auto range, auto &my_perm, auto &all_perm) {
             auto range_without_nulls = resultWithoutNulls(std::move(range));
@@ -709,34 +658,6 @@ namespace iroha {
 
     QueryExecutorResult PostgresSpecificQueryExecutor::operator()(
         const shared_model::interface::GetAccountAssetTransactions &q) {
-      std::string related_txs = R"(SELECT DISTINCT height, index
-          FROM position_by_account_asset
-          WHERE account_id = :account_id
-          AND asset_id = :asset_id
-          ORDER BY height, index ASC)";  // consider index when changing this
-
-      const auto &pagination_info = q.paginationMeta();
-      auto first_hash = pagination_info.firstTxHash();
-      // retrieve one extra transaction to populate next_hash
-      auto query_size = pagination_info.pageSize() + 1u;
-
-      auto apply_query = [&](const auto &query) {
-        return [&] {
-          if (first_hash) {
-            return (sql_.prepare << query,
-                    soci::use(q.accountId()),
-                    soci::use(q.assetId()),
-                    soci::use(first_hash->hex()),
-                    soci::use(query_size));
-          } else {
-            return (sql_.prepare << query,
-                    soci::use(q.accountId()),
-                    soci::use(q.assetId()),
-                    soci::use(query_size));
-          }
-        };
-      };
-
       auto check_query = [this](const auto &q) {
         if (not this->existsInDb<int>(
                 "account", "account_id", "quorum", q.accountId())) {
@@ -752,13 +673,14 @@ namespace iroha {
         return QueryFallbackCheckResult{};
       };
 
-      return executeTransactionsQuery(q,
-                                      std::move(check_query),
-                                      related_txs,
-                                      apply_query,
-                                      Role::kGetMyAccAstTxs,
-                                      Role::kGetAllAccAstTxs,
-                                      Role::kGetDomainAccAstTxs);
+      return executeTransactionsQuery(
+          q,
+          std::move(check_query),
+          "getAccountAssetTransactions",
+          {sqlValue(q.accountId()), sqlValue(q.assetId())},
+          Role::kGetMyAccAstTxs,
+          Role::kGetAllAccAstTxs,
+          Role::kGetDomainAccAstTxs);
     }
 
     QueryExecutorResult PostgresSpecificQueryExecutor::operator()(
@@ -770,52 +692,6 @@ namespace iroha {
                     size_t>;
       using PermissionTuple = boost::tuple<int>;
 
-      // get the assets
-      auto cmd = (boost::format(R"(
-      with has_perms as (%s),
-      all_data as (
-          select row_number() over () rn, *
-          from (
-              select *
-              from account_has_asset
-              where account_id = :account_id
-              order by asset_id
-          ) t
-      ),
-      total_number as (
-          select rn total_number
-          from all_data
-          order by rn desc
-          limit 1
-      ),
-      page_start as (
-          select rn
-          from all_data
-          where coalesce(asset_id = :first_asset_id, true)
-          limit 1
-      ),
-      page_data as (
-          select * from all_data, page_start, total_number
-          where
-              all_data.rn >= page_start.rn and
-              coalesce( -- TODO remove after pagination is mandatory IR-516
-                  all_data.rn < page_start.rn + :page_size,
-                  true
-              )
-      )
-      select account_id, asset_id, amount, total_number, perm
-          from
-              page_data
-              right join has_perms on true
-      )")
-                  % hasQueryPermission(creator_id_,
-                                       q.accountId(),
-                                       Role::kGetMyAccAst,
-                                       Role::kGetAllAccAst,
-                                       Role::kGetDomainAccAst))
-                     .str();
-
-      // These must stay alive while soci query is being done.
       const auto pagination_meta{q.paginationMeta()};
       const auto req_first_asset_id =
           pagination_meta | [](const auto &pagination_meta) {
@@ -827,13 +703,20 @@ namespace iroha {
             return boost::optional<size_t>(pagination_meta.pageSize() + 1);
           };
 
+      // get the assets
+      auto cmd = executeStatementSql(
+          "getAccountAssets",
+          hasQueryPermission(creator_id_,
+                             q.accountId(),
+                             Role::kGetMyAccAst,
+                             Role::kGetAllAccAst,
+                             Role::kGetDomainAccAst),
+          q.accountId(),
+          req_first_asset_id,
+          req_page_size);
+
       return executeQuery<QueryTuple, PermissionTuple>(
-          [&] {
-            return (sql_.prepare << cmd,
-                    soci::use(q.accountId(), "account_id"),
-                    soci::use(req_first_asset_id, "first_asset_id"),
-                    soci::use(req_page_size, "page_size"));
-          },
+          [&] { return (sql_.prepare << cmd); },
           [&](auto range, auto &) {
             auto range_without_nulls = resultWithoutNulls(std::move(range));
             std::vector<
@@ -889,88 +772,6 @@ namespace iroha {
                     uint32_t>;
       using PermissionTuple = boost::tuple<int>;
 
-      auto cmd = (boost::format(R"(
-      with has_perms as (%s),
-      detail AS (
-          with filtered_plain_data as (
-              select row_number() over () rn, *
-              from (
-                  select
-                      data_by_writer.key writer,
-                      plain_data.key as key,
-                      plain_data.value as value
-                  from
-                      jsonb_each((
-                          select data
-                          from account
-                          where account_id = :account_id
-                      )) data_by_writer,
-                  jsonb_each(data_by_writer.value) plain_data
-                  where
-                      coalesce(data_by_writer.key = :writer, true) and
-                      coalesce(plain_data.key = :key, true)
-                  order by data_by_writer.key asc, plain_data.key asc
-              ) t
-          ),
-          page_limits as (
-              select start.rn as start, start.rn + :page_size as end
-                  from (
-                      select rn
-                      from filtered_plain_data
-                      where
-                          coalesce(writer = :first_record_writer, true) and
-                          coalesce(key = :first_record_key, true)
-                      limit 1
-                  ) start
-          ),
-          total_number as (select count(1) total_number from filtered_plain_data),
-          next_record as (
-              select writer, key
-              from
-                  filtered_plain_data,
-                  page_limits
-              where rn = page_limits.end
-          ),
-          page as (
-              select json_object_agg(writer, data_by_writer) json
-              from (
-                  select writer, json_object_agg(key, value) data_by_writer
-                  from
-                      filtered_plain_data,
-                      page_limits
-                  where
-                      rn >= page_limits.start and
-                      coalesce(rn < page_limits.end, true)
-                  group by writer
-              ) t
-          ),
-          target_account_exists as (
-            select count(1) val
-            from account
-            where account_id = :account_id
-          )
-          select
-              page.json json,
-              total_number,
-              next_record.writer next_writer,
-              next_record.key next_key,
-              target_account_exists.val target_account_exists
-          from
-              page
-              left join total_number on true
-              left join next_record on true
-              right join target_account_exists on true
-      )
-      select detail.*, perm from detail
-      right join has_perms on true
-      )")
-                  % hasQueryPermission(creator_id_,
-                                       q.accountId(),
-                                       Role::kGetMyAccDetail,
-                                       Role::kGetAllAccDetail,
-                                       Role::kGetDomainAccDetail))
-                     .str();
-
       const auto writer = q.writer();
       const auto key = q.key();
       boost::optional<std::string> first_record_writer;
@@ -986,16 +787,22 @@ namespace iroha {
         };
       };
 
+      auto cmd = executeStatementSql(
+          "getAccountDetail",
+          hasQueryPermission(creator_id_,
+                             q.accountId(),
+                             Role::kGetMyAccDetail,
+                             Role::kGetAllAccDetail,
+                             Role::kGetDomainAccDetail),
+          q.accountId(),
+          writer,
+          key,
+          first_record_writer,
+          first_record_key,
+          page_size);
+
       return executeQuery<QueryTuple, PermissionTuple>(
-          [&] {
-            return (sql_.prepare << cmd,
-                    soci::use(q.accountId(), "account_id"),
-                    soci::use(writer, "writer"),
-                    soci::use(key, "key"),
-                    soci::use(first_record_writer, "first_record_writer"),
-                    soci::use(first_record_key, "first_record_key"),
-                    soci::use(page_size, "page_size"));
-          },
+          [&] { return (sql_.prepare << cmd); },
           [&, this](auto range, auto &) {
             if (range.empty()) {
               assert(not range.empty());
@@ -1080,18 +887,11 @@ namespace iroha {
       using QueryTuple = QueryType<shared_model::interface::types::RoleIdType>;
       using PermissionTuple = boost::tuple<int>;
 
-      auto cmd = (boost::format(
-                      R"(WITH has_perms AS (%s)
-      SELECT role_id, perm FROM role
-      RIGHT OUTER JOIN has_perms ON TRUE
-      )") % getAccountRolePermissionCheckSql(Role::kGetRoles))
-                     .str();
+      auto cmd = executeStatementSql(
+          "getRoles", hasAccountRolePermission(Role::kGetRoles, creator_id_));
 
       return executeQuery<QueryTuple, PermissionTuple>(
-          [&] {
-            return (sql_.prepare << cmd,
-                    soci::use(creator_id_, "role_account_id"));
-          },
+          [&] { return (sql_.prepare << cmd); },
           [&](auto range, auto &) {
             auto range_without_nulls = resultWithoutNulls(std::move(range));
             auto roles = boost::copy_range<
@@ -1111,21 +911,13 @@ namespace iroha {
       using QueryTuple = QueryType<std::string>;
       using PermissionTuple = boost::tuple<int>;
 
-      auto cmd = (boost::format(
-                      R"(WITH has_perms AS (%s),
-      perms AS (SELECT permission FROM role_has_permissions
-                WHERE role_id = :role_name)
-      SELECT permission, perm FROM perms
-      RIGHT OUTER JOIN has_perms ON TRUE
-      )") % getAccountRolePermissionCheckSql(Role::kGetRoles))
-                     .str();
+      auto cmd = executeStatementSql(
+          "getRolePermissions",
+          hasAccountRolePermission(Role::kGetRoles, creator_id_),
+          q.roleId());
 
       return executeQuery<QueryTuple, PermissionTuple>(
-          [&] {
-            return (sql_.prepare << cmd,
-                    soci::use(creator_id_, "role_account_id"),
-                    soci::use(q.roleId(), "role_name"));
-          },
+          [&] { return (sql_.prepare << cmd); },
           [this, &q](auto range, auto &) {
             auto range_without_nulls = resultWithoutNulls(std::move(range));
             if (range_without_nulls.empty()) {
@@ -1150,21 +942,13 @@ namespace iroha {
           QueryType<shared_model::interface::types::DomainIdType, uint32_t>;
       using PermissionTuple = boost::tuple<int>;
 
-      auto cmd = (boost::format(
-                      R"(WITH has_perms AS (%s),
-      perms AS (SELECT domain_id, precision FROM asset
-                WHERE asset_id = :asset_id)
-      SELECT domain_id, precision, perm FROM perms
-      RIGHT OUTER JOIN has_perms ON TRUE
-      )") % getAccountRolePermissionCheckSql(Role::kReadAssets))
-                     .str();
+      auto cmd = executeStatementSql(
+          "getAssetInfo",
+          hasAccountRolePermission(Role::kReadAssets, creator_id_),
+          q.assetId());
 
       return executeQuery<QueryTuple, PermissionTuple>(
-          [&] {
-            return (sql_.prepare << cmd,
-                    soci::use(creator_id_, "role_account_id"),
-                    soci::use(q.assetId(), "asset_id"));
-          },
+          [&] { return (sql_.prepare << cmd); },
           [this, &q](auto range, auto &) {
             auto range_without_nulls = resultWithoutNulls(std::move(range));
             if (range_without_nulls.empty()) {
@@ -1253,18 +1037,11 @@ namespace iroha {
           QueryType<std::string, shared_model::interface::types::AddressType>;
       using PermissionTuple = boost::tuple<int>;
 
-      auto cmd = (boost::format(
-                      R"(WITH has_perms AS (%s)
-      SELECT public_key, address, perm FROM peer
-      RIGHT OUTER JOIN has_perms ON TRUE
-      )") % getAccountRolePermissionCheckSql(Role::kGetPeers))
-                     .str();
+      auto cmd = executeStatementSql(
+          "getPeers", hasAccountRolePermission(Role::kGetPeers, creator_id_));
 
       return executeQuery<QueryTuple, PermissionTuple>(
-          [&] {
-            return (sql_.prepare << cmd,
-                    soci::use(creator_id_, "role_account_id"));
-          },
+          [&] { return (sql_.prepare << cmd); },
           [&](auto range, auto &) {
             auto range_without_nulls = resultWithoutNulls(std::move(range));
             shared_model::interface::types::PeerList peers;
@@ -1298,5 +1075,290 @@ namespace iroha {
       return result.begin() != result.end();
     }
 
+    void PostgresSpecificQueryExecutor::prepareStatements(soci::session &sql) {
+      // the first argument of each query is the result of the permission
+      // check, which is performed by the executor before running the query
+      std::vector<std::string> statements;
+
+      statements.push_back(
+          (boost::format(R"(
+      PREPARE getAccountPermissions (text) AS
+      SELECT COALESCE(bit_or(rp.permission), '0'::bit(%1%))
+      FROM role_has_permissions AS rp
+          JOIN account_has_roles AS ar on ar.role_id = rp.role_id
+          WHERE ar.account_id = $1
+      )") % shared_model::interface::RolePermissionSet::size())
+              .str());
+
+      statements.push_back(R"(
+      PREPARE getAccount (boolean, text) AS
+      WITH has_perms AS (SELECT $1 AS perm),
+      t AS (
+          SELECT a.account_id, a.domain_id, a.quorum, ARRAY_AGG(ar.role_id) AS roles
+          FROM account AS a, account_has_roles AS ar
+          WHERE a.account_id = $2
+          AND ar.account_id = a.account_id
+          GROUP BY a.account_id
+      ),
+      data AS (
+          SELECT COALESCE(jsonb_object_agg(writer, data_by_writer), '{}') AS data
+          FROM (
+              SELECT writer, jsonb_object_agg(key, value) AS data_by_writer
+              FROM account_has_detail
+              WHERE account_id = $2
+              GROUP BY writer
+          ) d
+      )
+      SELECT account_id, domain_id, quorum, data, roles, perm
+      FROM t CROSS JOIN data RIGHT OUTER JOIN has_perms AS p ON TRUE
+      )");
+
+      statements.push_back(R"(
+      PREPARE getSignatories (boolean, text) AS
+      WITH has_perms AS (SELECT $1 AS perm),
+      t AS (
+          SELECT public_key FROM account_has_signatory
+          WHERE account_id = $2
+      )
+      SELECT public_key, perm FROM t
+      RIGHT OUTER JOIN has_perms ON TRUE
+      )");
+
+      // %1% - name and argument types, %2% - transactions relevant to the
+      // query, %3% - first transaction of the page, %4% - page size
+      auto transactions_base = R"(
+      PREPARE %1% AS
+      WITH has_perms AS (SELECT $1 AS perm),
+      my_txs AS (%2%),
+      first_hash AS (%3%),
+      total_size AS (
+        SELECT COUNT(*) FROM my_txs
+      ),
+      t AS (
+        SELECT my_txs.height, my_txs.index
+        FROM my_txs JOIN
+        first_hash ON my_txs.height > first_hash.height
+        OR (my_txs.height = first_hash.height AND
+            my_txs.index >= first_hash.index)
+        LIMIT %4%
+      )
+      SELECT t.height, t.index, count,
+          COALESCE(tx.data, '') AS data, perm FROM t
+      LEFT JOIN tx_data_by_position AS tx
+          ON tx.height = t.height AND tx.index = t.index
+      RIGHT OUTER JOIN has_perms ON TRUE
+      JOIN total_size ON TRUE
+      )";
+
+      // select tx with specified hash
+      auto first_by_hash = R"(SELECT height, index FROM position_by_hash
+      WHERE hash = %1% LIMIT 1)";
+
+      // select first ever tx
+      auto first_tx = R"(SELECT height, index FROM position_by_hash
+      ORDER BY height, index ASC LIMIT 1)";
+
+      auto account_txs = R"(SELECT DISTINCT height, index
+      FROM tx_position_by_creator
+      WHERE creator_id = $2
+      ORDER BY height, index ASC)";
+
+      statements.push_back(
+          (boost::format(transactions_base)
+           % "getAccountTransactions (boolean, text, bigint)" % account_txs
+           % first_tx % "$3")
+              .str());
+      statements.push_back(
+          (boost::format(transactions_base)
+           % "getAccountTransactionsFromHash (boolean, text, bigint, text)"
+           % account_txs % (boost::format(first_by_hash) % "$4").str() % "$3")
+              .str());
+
+      auto account_asset_txs = R"(SELECT DISTINCT height, index
+          FROM position_by_account_asset
+          WHERE account_id = $2
+          AND asset_id = $3
+          ORDER BY height, index ASC)";  // consider index when changing this
+
+      statements.push_back(
+          (boost::format(transactions_base)
+           % "getAccountAssetTransactions (boolean, text, text, bigint)"
+           % account_asset_txs % first_tx % "$4")
+              .str());
+      statements.push_back(
+          (boost::format(transactions_base)
+           % "getAccountAssetTransactionsFromHash "
+             "(boolean, text, text, bigint, text)"
+           % account_asset_txs % (boost::format(first_by_hash) % "$5").str()
+           % "$4")
+              .str());
+
+      statements.push_back(R"(
+      PREPARE getTransactions (boolean, boolean, text[]) AS
+      WITH has_my_perm AS (SELECT $1 AS perm),
+      has_all_perm AS (SELECT $2 AS perm),
+      t AS (
+          SELECT height, hash FROM position_by_hash WHERE hash = ANY($3)
+      )
+      SELECT height, hash, has_my_perm.perm, has_all_perm.perm FROM t
+      RIGHT OUTER JOIN has_my_perm ON TRUE
+      RIGHT OUTER JOIN has_all_perm ON TRUE
+      )");
+
+      statements.push_back(R"(
+      PREPARE getAccountAssets (boolean, text, text, bigint) AS
+      with has_perms as (SELECT $1 AS perm),
+      total_number as (
+          select cast(coalesce(sum(count), 0) as bigint) total_number
+          from account_asset_count
+          where account_id = $2
+      ),
+      page_data as (
+          select account_id, asset_id, amount, total_number
+          from account_has_asset, total_number
+          where
+              account_id = $2 and
+              coalesce(asset_id >= $3, true) and
+              (
+                  $3 is null or
+                  exists (
+                      select 1
+                      from account_has_asset
+                      where account_id = $2 and asset_id = $3
+                  )
+              )
+          order by asset_id
+          limit $4 -- TODO remove NULL after pagination is mandatory IR-516
+      )
+      select account_id, asset_id, amount, total_number, perm
+          from
+              page_data
+              right join has_perms on true
+      )");
+
+      statements.push_back(R"(
+      PREPARE getAccountDetail (boolean, text, text, text, text, text, bigint) AS
+      with has_perms as (SELECT $1 AS perm),
+      detail AS (
+          with page_plain_data as (
+              select row_number() over () rn, *
+              from (
+                  select writer, key, value
+                  from account_has_detail
+                  where
+                      account_id = $2 and
+                      coalesce(writer = $3, true) and
+                      coalesce(key = $4, true) and
+                      (writer, key) >= (
+                          select writer, key
+                          from account_has_detail
+                          where
+                              account_id = $2 and
+                              coalesce(writer = $3, true) and
+                              coalesce(key = $4, true) and
+                              coalesce(writer = $5, true) and
+                              coalesce(key = $6, true)
+                          order by writer, key
+                          limit 1
+                      )
+                  order by writer, key
+                  limit $7 + 1
+              ) t
+          ),
+          total_number as (
+              -- counters are maintained per writer, while the details of a
+              -- single key are looked up by index, one per writer
+              select case
+                  when $4 is null then (
+                      select cast(coalesce(sum(count), 0) as bigint)
+                      from account_detail_count
+                      where
+                          account_id = $2 and
+                          coalesce(writer = $3, true)
+                  )
+                  else (
+                      select count(1)
+                      from account_has_detail
+                      where
+                          account_id = $2 and
+                          coalesce(writer = $3, true) and
+                          key = $4
+                  )
+              end total_number
+          ),
+          next_record as (
+              select writer, key
+              from page_plain_data
+              where rn = $7 + 1
+          ),
+          page as (
+              select json_object_agg(writer, data_by_writer order by writer) json
+              from (
+                  select
+                      writer,
+                      json_object_agg(key, value order by key) data_by_writer
+                  from page_plain_data
+                  where coalesce(rn <= $7, true)
+                  group by writer
+              ) t
+          ),
+          target_account_exists as (
+            select count(1) val
+            from account
+            where account_id = $2
+          )
+          select
+              page.json json,
+              total_number,
+              next_record.writer next_writer,
+              next_record.key next_key,
+              target_account_exists.val target_account_exists
+          from
+              page
+              left join total_number on true
+              left join next_record on true
+              right join target_account_exists on true
+      )
+      select detail.*, perm from detail
+      right join has_perms on true
+      )");
+
+      statements.push_back(R"(
+      PREPARE getRoles (boolean) AS
+      WITH has_perms AS (SELECT $1 AS perm)
+      SELECT role_id, perm FROM role
+      RIGHT OUTER JOIN has_perms ON TRUE
+      )");
+
+      statements.push_back(R"(
+      PREPARE getRolePermissions (boolean, text) AS
+      WITH has_perms AS (SELECT $1 AS perm),
+      perms AS (SELECT permission FROM role_has_permissions
+                WHERE role_id = $2)
+      SELECT permission, perm FROM perms
+      RIGHT OUTER JOIN has_perms ON TRUE
+      )");
+
+      statements.push_back(R"(
+      PREPARE getAssetInfo (boolean, text) AS
+      WITH has_perms AS (SELECT $1 AS perm),
+      perms AS (SELECT domain_id, precision FROM asset
+                WHERE asset_id = $2)
+      SELECT domain_id, precision, perm FROM perms
+      RIGHT OUTER JOIN has_perms ON TRUE
+      )");
+
+      statements.push_back(R"(
+      PREPARE getPeers (boolean) AS
+      WITH has_perms AS (SELECT $1 AS perm)
+      SELECT public_key, address, perm FROM peer
+      RIGHT OUTER JOIN has_perms ON TRUE
+      )");
+
+      for (const auto &statement : statements) {
+        sql << statement;
+      }
+    }
+
   }  // namespace ametsuchi
 }  // namespace iroha
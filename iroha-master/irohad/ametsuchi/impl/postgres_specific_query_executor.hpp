@@ -8,7 +8,10 @@
 
 #include "ametsuchi/specific_query_executor.hpp"
 
+#include <map>
+
 #include <soci/soci.h>
+#include "common/result.hpp"
 #include "interfaces/iroha_internal/query_response_factory.hpp"
 #include "logger/logger_fwd.hpp"
 
@@ -37,6 +40,7 @@ namespace iroha {
 
   namespace ametsuchi {
 
+    class AccountPermissionCache;
     class BlockStorage;
 
     using QueryErrorType =
@@ -56,6 +60,7 @@ namespace iroha {
               response_factory,
           std::shared_ptr<shared_model::interface::PermissionToString>
               perm_converter,
+          std::shared_ptr<AccountPermissionCache> permission_cache,
           logger::LoggerPtr log);
 
       QueryExecutorResult execute(
@@ -109,7 +114,37 @@ namespace iroha {
       QueryExecutorResult operator()(
           const shared_model::interface::GetPeers &q);
 
+      /**
+       * Prepare statements of all the queries in the session, so that they
+       * are parsed and planned once per connection
+       * @param sql - session to prepare statements in
+       */
+      static void prepareStatements(soci::session &sql);
+
      private:
+      /**
+       * Get role permissions of the account from the permission cache
+       * @param account_id - account to get permissions of
+       * @return permissions or boost::none if they could not be retrieved
+       */
+      boost::optional<shared_model::interface::RolePermissionSet>
+      getAccountPermissions(
+          const shared_model::interface::types::AccountIdType &account_id)
+          const;
+
+      /**
+       * Check if creator has corresponding permissions for target account
+       * It verifies individual, domain, and global permissions, and returns
+       * true if any of listed permissions is present
+       */
+      bool hasQueryPermission(
+          const shared_model::interface::types::AccountIdType &creator,
+          const shared_model::interface::types::AccountIdType &target_account,
+          shared_model::interface::permissions::Role indiv_permission_id,
+          shared_model::interface::permissions::Role all_permission_id,
+          shared_model::interface::permissions::Role domain_permission_id)
+          const;
+
       /**
        * Get transactions from block using range from range_gen and filtered by
        * predicate pred
@@ -120,6 +155,26 @@ namespace iroha {
                                RangeGen &&range_gen,
                                Pred &&pred);
 
+      /// (block height, index in the block) -> serialized transaction in the
+      /// hex output format of bytea
+      using TxPositions =
+          std::map<std::pair<shared_model::interface::types::HeightType,
+                             uint64_t>,
+                   std::string>;
+
+      /**
+       * Get transactions at the given positions. Transactions are deserialized
+       * one by one from the transaction index, whole blocks are loaded only
+       * for the transactions missing in it
+       * @param positions of transactions, ordered as they are in the ledger
+       * @return transactions in ledger order, or an error if some of them
+       * could not be loaded
+       */
+      iroha::expected::Result<
+          std::vector<std::unique_ptr<shared_model::interface::Transaction>>,
+          std::string>
+      getTransactionsByPositions(const TxPositions &positions);
+
       /**
        * Execute query and return its response
        * @tparam QueryTuple - types of values, returned by the query
@@ -162,22 +217,21 @@ namespace iroha {
        * @param query - query object
        * @param qry_checker - fallback checker of the query, needed if paging
        * hash is not specified and 0 transaction are returned as a query result
-       * @param related_txs - SQL query which returns transaction relevant
-       * to this query
-       * @param applier - function which accepts SQL
-       * and returns another function which executes that query
+       * @param statement - name of the prepared statement, which returns
+       * transactions relevant to this query
+       * @param arguments - SQL values of the statement arguments, which
+       * select the relevant transactions
        * @param perms - permissions, necessary to execute the query
        * @return Result of a query execution
        */
       template <typename Query,
                 typename QueryChecker,
-                typename QueryApplier,
                 typename... Permissions>
       QueryExecutorResult executeTransactionsQuery(
           const Query &query,
           QueryChecker &&qry_checker,
-          const std::string &related_txs,
-          QueryApplier applier,
+          const std::string &statement,
+          std::vector<std::string> arguments,
           Permissions... perms);
 
       /**
@@ -231,6 +285,7 @@ namespace iroha {
           query_response_factory_;
       std::shared_ptr<shared_model::interface::PermissionToString>
           perm_converter_;
+      std::shared_ptr<AccountPermissionCache> permission_cache_;
       logger::LoggerPtr log_;
     };
 
@@ -177,8 +177,13 @@ namespace iroha {
     WsvCommandResult PostgresWsvCommand::insertAccount(
         const shared_model::interface::Account &account) {
       soci::statement st = sql_.prepare
-          << "INSERT INTO account(account_id, domain_id, quorum,"
-             "data) VALUES (:id, :domain_id, :quorum, :data)";
+          << "WITH inserted AS (INSERT INTO account(account_id, domain_id, "
+             "quorum) VALUES (:id, :domain_id, :quorum) RETURNING account_id) "
+             "INSERT INTO account_has_detail(account_id, writer, key, value) "
+             "SELECT inserted.account_id, data_by_writer.key, plain_data.key, "
+             "plain_data.value #>> '{}' FROM inserted, "
+             "jsonb_each(NULLIF(:data, '')::jsonb) data_by_writer, "
+             "jsonb_each(data_by_writer.value) plain_data";
       uint32_t quorum = account.quorum();
       st.exchange(soci::use(account.accountId()));
       st.exchange(soci::use(account.domainId()));
@@ -382,20 +387,14 @@ namespace iroha {
         const std::string &key,
         const std::string &val) {
       soci::statement st = sql_.prepare
-          << "UPDATE account SET data = jsonb_set("
-             "CASE WHEN data ?:creator_account_id THEN data ELSE "
-             "jsonb_set(data, :json, :empty_json) END, "
-             " :filled_json, :val) WHERE account_id=:account_id";
-      std::string json = "{" + creator_account_id + "}";
-      std::string empty_json = "{}";
-      std::string filled_json = "{" + creator_account_id + ", " + key + "}";
-      std::string value = "\"" + val + "\"";
-      st.exchange(soci::use(creator_account_id));
-      st.exchange(soci::use(json));
-      st.exchange(soci::use(empty_json));
-      st.exchange(soci::use(filled_json));
-      st.exchange(soci::use(value));
+          << "INSERT INTO account_has_detail(account_id, writer, key, value) "
+             "VALUES (:account_id, :writer, :key, :value) "
+             "ON CONFLICT (account_id, writer, key) "
+             "DO UPDATE SET value = EXCLUDED.value";
       st.exchange(soci::use(account_id));
+      st.exchange(soci::use(creator_account_id));
+      st.exchange(soci::use(key));
+      st.exchange(soci::use(val));
 
       auto msg = [&] {
         return (boost::format(
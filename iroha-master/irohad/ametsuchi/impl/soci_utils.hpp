@@ -6,7 +6,14 @@
 #ifndef IROHA_POSTGRES_WSV_COMMON_HPP
 #define IROHA_POSTGRES_WSV_COMMON_HPP
 
+#include <string>
+#include <type_traits>
+#include <vector>
+
 #include <soci/soci.h>
+#include <boost/algorithm/string/join.hpp>
+#include <boost/algorithm/string/predicate.hpp>
+#include <boost/algorithm/string/replace.hpp>
 #include <boost/optional.hpp>
 #include <boost/range/adaptor/filtered.hpp>
 #include <boost/range/adaptor/transformed.hpp>
@@ -157,6 +164,64 @@ namespace iroha {
       };
     }
 
+    /**
+     * SQL literals of the values, to be used as the arguments of EXECUTE,
+     * since Postgres does not accept bound parameters there
+     * @return SQL literal of the value
+     */
+    inline std::string sqlValue(bool value) {
+      return value ? "true" : "false";
+    }
+
+    /// The string is quoted the same way as quote_literal of Postgres does,
+    /// so the result does not depend on standard_conforming_strings
+    inline std::string sqlValue(const std::string &value) {
+      auto quoted = boost::replace_all_copy(value, "'", "''");
+      if (boost::contains(quoted, "\\")) {
+        boost::replace_all(quoted, "\\", "\\\\");
+        return "E'" + quoted + "'";
+      }
+      return "'" + quoted + "'";
+    }
+
+    inline std::string sqlValue(const std::vector<std::string> &values) {
+      std::vector<std::string> literals;
+      for (const auto &value : values) {
+        literals.push_back(sqlValue(value));
+      }
+      return "ARRAY[" + boost::algorithm::join(literals, ", ") + "]::text[]";
+    }
+
+    template <typename T>
+    inline std::enable_if_t<std::is_integral<T>::value, std::string>
+    sqlValue(T value) {
+      return std::to_string(value);
+    }
+
+    template <typename T>
+    inline std::string sqlValue(const boost::optional<T> &value) {
+      return value ? sqlValue(*value) : "NULL";
+    }
+
+    /**
+     * Generate an SQL command which executes prepared statement
+     * @param statement - name of the statement
+     * @param arguments - SQL values of the statement arguments
+     */
+    inline std::string executeStatementSql(
+        const std::string &statement,
+        const std::vector<std::string> &arguments) {
+      return "EXECUTE " + statement + " ("
+          + boost::algorithm::join(arguments, ", ") + ")";
+    }
+
+    template <typename... Args>
+    inline std::string executeStatementSql(const std::string &statement,
+                                           const Args &... args) {
+      return executeStatementSql(statement,
+                                 std::vector<std::string>{sqlValue(args)...});
+    }
+
   }  // namespace ametsuchi
 }  // namespace iroha
 
@@ -13,7 +13,6 @@
 #include <boost/format.hpp>
 #include <boost/range/algorithm/replace_if.hpp>
 #include "ametsuchi/impl/mutable_storage_impl.hpp"
-#include "ametsuchi/impl/peer_query_wsv.hpp"
 #include "ametsuchi/impl/postgres_block_index.hpp"
 #include "ametsuchi/impl/postgres_block_query.hpp"
 #include "ametsuchi/impl/postgres_block_storage_factory.hpp"
@@ -51,11 +50,28 @@ namespace iroha {
         size_t pool_size,
         logger::LoggerManagerTreePtr log_manager)
         : postgres_options_(std::move(postgres_options)),
-          block_store_(std::move(block_store)),
+          async_block_store_(std::make_shared<AsyncBlockStorage>(
+              std::move(block_store),
+              AsyncBlockStorage::kDefaultMaxPendingBlocks,
+              log_manager->getChild("AsyncBlockStorage")->getLogger())),
+          block_store_(std::make_unique<CachedBlockStorage>(
+              async_block_store_, CachedBlockStorage::kDefaultCapacity)),
           pool_wrapper_(std::move(pool_wrapper)),
           connection_(pool_wrapper_->connection_pool_),
           notifier_(notifier_lifetime_),
           perm_converter_(std::move(perm_converter)),
+          permission_cache_(std::make_shared<AccountPermissionCache>()),
+          peer_registry_(std::make_shared<PeerRegistry>(
+              [pool_wrapper = pool_wrapper_,
+               log = log_manager->getChild("WsvQuery")->getLogger()]()
+                  -> boost::optional<shared_model::interface::types::PeerList> {
+                auto connection = pool_wrapper->connection_pool_;
+                if (not connection) {
+                  return boost::none;
+                }
+                soci::session sql(*connection);
+                return PostgresWsvQuery(sql, log).getPeers();
+              })),
           temporary_block_storage_factory_(
               std::move(temporary_block_storage_factory)),
           log_manager_(std::move(log_manager)),
@@ -65,7 +81,17 @@ namespace iroha {
               pool_wrapper_->enable_prepared_transactions_),
           block_is_prepared_(false),
           prepared_block_name_(postgres_options_->preparedBlockName()),
-          ledger_state_(std::move(ledger_state)) {}
+          ledger_state_(std::move(ledger_state)),
+          session_wait_histogram_(metrics::defaultRegistry().histogram(
+              "iroha_storage_session_wait_seconds",
+              "Time of waiting for a free database connection")),
+          commit_duration_histogram_(metrics::defaultRegistry().histogram(
+              "iroha_storage_commit_duration_seconds",
+              "Time of committing a block to the storage")) {
+      if (ledger_state_) {
+        peer_registry_->update(ledger_state_.value()->ledger_peers);
+      }
+    }
 
     expected::Result<std::unique_ptr<TemporaryWsv>, std::string>
     StorageImpl::createTemporaryWsv() {
@@ -73,7 +99,7 @@ namespace iroha {
       if (connection_ == nullptr) {
         return expected::makeError("Connection was closed");
       }
-      auto sql = std::make_unique<soci::session>(*connection_);
+      auto sql = createSession();
       // if we create temporary storage, then we intend to validate a new
       // proposal. this means that any state prepared before that moment is
       // not needed and must be removed to prevent locking
@@ -95,12 +121,13 @@ namespace iroha {
 
     boost::optional<std::shared_ptr<PeerQuery>> StorageImpl::createPeerQuery()
         const {
-      auto wsv = getWsvQuery();
-      if (not wsv) {
+      std::shared_lock<std::shared_timed_mutex> lock(drop_mutex_);
+      if (not connection_) {
+        log_->info(
+            "createPeerQuery: connection to database is not initialised");
         return boost::none;
       }
-      return boost::make_optional<std::shared_ptr<PeerQuery>>(
-          std::make_shared<PeerQueryWsv>(wsv));
+      return boost::make_optional<std::shared_ptr<PeerQuery>>(peer_registry_);
     }
 
     boost::optional<std::shared_ptr<BlockQuery>> StorageImpl::createBlockQuery()
@@ -123,7 +150,7 @@ namespace iroha {
             "createQueryExecutor: connection to database is not initialised");
         return boost::none;
       }
-      auto sql = std::make_unique<soci::session>(*connection_);
+      auto sql = createSession();
       auto log_manager = log_manager_->getChild("QueryExecutor");
       return boost::make_optional<std::shared_ptr<QueryExecutor>>(
           std::make_shared<PostgresQueryExecutor>(
@@ -135,6 +162,7 @@ namespace iroha {
                   std::move(pending_txs_storage),
                   response_factory,
                   perm_converter_,
+                  permission_cache_,
                   log_manager->getChild("SpecificQueryExecutor")->getLogger()),
               log_manager->getLogger()));
     }
@@ -158,7 +186,9 @@ namespace iroha {
       log_->info("Insert peer {}", peer.pubkey().hex());
       soci::session sql(*connection_);
       PostgresWsvCommand wsv_command(sql);
-      return wsv_command.insertPeer(peer);
+      auto result = wsv_command.insertPeer(peer);
+      peer_registry_->invalidate();
+      return result;
     }
 
     expected::Result<std::unique_ptr<MutableStorage>, std::string>
@@ -168,7 +198,7 @@ namespace iroha {
         return expected::makeError("Connection was closed");
       }
 
-      auto sql = std::make_unique<soci::session>(*connection_);
+      auto sql = createSession();
       // if we create mutable storage, then we intend to mutate wsv
       // this means that any state prepared before that moment is not needed
       // and must be removed to prevent locking
@@ -201,6 +231,8 @@ namespace iroha {
         soci::session sql(*connection_);
         // rollback possible prepared transaction
         tryRollback(sql);
+        permission_cache_->invalidateAll();
+        peer_registry_->invalidate();
         return PgConnectionInit::resetWsv(sql);
       } catch (std::exception &e) {
         return expected::makeError(e.what());
@@ -212,6 +244,7 @@ namespace iroha {
       soci::session sql(*connection_);
       expected::resultToOptionalError(PgConnectionInit::resetPeers(sql)) |
           [this](const auto &e) { this->log_->error("{}", e); };
+      peer_registry_->invalidate();
     }
 
     void StorageImpl::dropStorage() {
@@ -226,6 +259,8 @@ namespace iroha {
       // erase blocks
       log_->info("drop block store");
       block_store_->clear();
+      permission_cache_->invalidateAll();
+      peer_registry_->invalidate();
 
       freeConnections();
       log_->info("Drop database {}", postgres_options_->workingDbName());
@@ -240,6 +275,10 @@ namespace iroha {
         log_->warn("Tried to free connections without active connection");
         return;
       }
+      // blocks can be written to the database
+      if (not async_block_store_->flush()) {
+        log_->error("Failed to write all the committed blocks");
+      }
       // rollback possible prepared transaction
       {
         soci::session sql(*connection_);
@@ -333,6 +372,7 @@ namespace iroha {
 
     CommitResult StorageImpl::commit(
         std::unique_ptr<MutableStorage> mutable_storage) {
+      metrics::ScopedTimer timer(commit_duration_histogram_);
       auto storage = static_cast<MutableStorageImpl *>(mutable_storage.get());
 
       try {
@@ -343,11 +383,19 @@ namespace iroha {
       }
       storage->committed = true;
 
+      bool peers_changed = false;
       storage->block_storage_->forEach(
-          [this](const auto &block) { this->storeBlock(block); });
+          [this, &peers_changed](const auto &block) {
+            permission_cache_->invalidate(*block);
+            peers_changed |= PeerRegistry::changesPeers(*block);
+            this->storeBlock(block);
+          });
 
       ledger_state_ = storage->getLedgerState();
       if (ledger_state_) {
+        if (peers_changed) {
+          peer_registry_->update(ledger_state_.value()->ledger_peers);
+        }
         return expected::makeValue(ledger_state_.value());
       } else {
         return expected::makeError(
@@ -372,6 +420,7 @@ namespace iroha {
       }
 
       log_->info("applying prepared block");
+      metrics::ScopedTimer timer(commit_duration_histogram_);
 
       try {
         std::shared_lock<std::shared_timed_mutex> lock(drop_mutex_);
@@ -382,6 +431,7 @@ namespace iroha {
         }
         soci::session sql(*connection_);
         sql << "COMMIT PREPARED '" + prepared_block_name_ + "';";
+        permission_cache_->invalidate(*block);
         PostgresBlockIndex block_index(
             std::make_unique<PostgresIndexer>(sql),
             log_manager_->getChild("BlockIndex")->getLogger());
@@ -389,9 +439,12 @@ namespace iroha {
         block_is_prepared_ = false;
 
         return storeBlock(block) | [this, &sql, &block]() -> CommitResult {
+          const bool peers_changed = PeerRegistry::changesPeers(*block);
           decltype(
               std::declval<PostgresWsvQuery>().getPeers()) opt_ledger_peers;
-          {
+          if (ledger_state_ and not peers_changed) {
+            opt_ledger_peers = ledger_state_.value()->ledger_peers;
+          } else {
             auto peer_query = PostgresWsvQuery(
                 sql, this->log_manager_->getChild("WsvQuery")->getLogger());
             if (not(opt_ledger_peers = peer_query.getPeers())) {
@@ -403,6 +456,9 @@ namespace iroha {
 
           ledger_state_ = std::make_shared<const LedgerState>(
               std::move(*opt_ledger_peers), block->height(), block->hash());
+          if (peers_changed) {
+            peer_registry_->update(ledger_state_.value()->ledger_peers);
+          }
           return expected::makeValue(ledger_state_.value());
         };
       } catch (const std::exception &e) {
@@ -420,7 +476,7 @@ namespace iroha {
         return nullptr;
       }
       return std::make_shared<PostgresWsvQuery>(
-          std::make_unique<soci::session>(*connection_),
+          createSession(),
           log_manager_->getChild("WsvQuery")->getLogger());
     }
 
@@ -431,7 +487,7 @@ namespace iroha {
         return nullptr;
       }
       return std::make_shared<PostgresBlockQuery>(
-          std::make_unique<soci::session>(*connection_),
+          createSession(),
           *block_store_,
           log_manager_->getChild("PostgresBlockQuery")->getLogger());
     }
@@ -478,6 +534,11 @@ namespace iroha {
       return expected::makeError("Block insertion to storage failed");
     }
 
+    std::unique_ptr<soci::session> StorageImpl::createSession() const {
+      metrics::ScopedTimer timer(session_wait_histogram_);
+      return std::make_unique<soci::session>(*connection_);
+    }
+
     void StorageImpl::tryRollback(soci::session &session) {
       // TODO 17.06.2019 luckychess IR-568 split connection and schema
       // initialisation
@@ -14,6 +14,10 @@
 #include <soci/soci.h>
 #include <boost/optional.hpp>
 #include "ametsuchi/block_storage_factory.hpp"
+#include "ametsuchi/impl/account_permission_cache.hpp"
+#include "ametsuchi/impl/async_block_storage.hpp"
+#include "ametsuchi/impl/cached_block_storage.hpp"
+#include "ametsuchi/impl/peer_registry.hpp"
 #include "ametsuchi/impl/pool_wrapper.hpp"
 #include "ametsuchi/impl/postgres_options.hpp"
 #include "ametsuchi/key_value_storage.hpp"
@@ -23,6 +27,7 @@
 #include "interfaces/permission_to_string.hpp"
 #include "logger/logger_fwd.hpp"
 #include "logger/logger_manager_fwd.hpp"
+#include "metrics/metrics.hpp"
 
 namespace iroha {
   namespace ametsuchi {
@@ -127,7 +132,20 @@ namespace iroha {
        */
       void tryRollback(soci::session &session);
 
-      std::unique_ptr<BlockStorage> block_store_;
+      /**
+       * Lease a session from the connection pool, measuring the wait for a
+       * free connection. Has to be called with drop_mutex_ locked and
+       * connection_ initialised
+       */
+      std::unique_ptr<soci::session> createSession() const;
+
+      /// persistent block storage, to which committed blocks are written in
+      /// background
+      std::shared_ptr<AsyncBlockStorage> async_block_store_;
+
+      /// async_block_store_ with recent blocks kept in memory, all the
+      /// readers of committed blocks use it
+      std::unique_ptr<CachedBlockStorage> block_store_;
 
       std::shared_ptr<PoolWrapper> pool_wrapper_;
 
@@ -142,6 +160,12 @@ namespace iroha {
       std::shared_ptr<shared_model::interface::PermissionToString>
           perm_converter_;
 
+      /// permissions of accounts in the committed WSV, shared by queries
+      std::shared_ptr<AccountPermissionCache> permission_cache_;
+
+      /// peers of the committed ledger, shared by peer queries
+      std::shared_ptr<PeerRegistry> peer_registry_;
+
       std::unique_ptr<BlockStorageFactory> temporary_block_storage_factory_;
 
       logger::LoggerManagerTreePtr log_manager_;
@@ -158,6 +182,12 @@ namespace iroha {
       std::string prepared_block_name_;
 
       boost::optional<std::shared_ptr<const iroha::LedgerState>> ledger_state_;
+
+      /// Time of waiting for a free connection of the pool
+      metrics::Histogram &session_wait_histogram_;
+
+      /// Time of committing a mutable storage or a prepared block
+      metrics::Histogram &commit_duration_histogram_;
     };
   }  // namespace ametsuchi
 }  // namespace iroha
@@ -48,6 +48,15 @@ namespace {
      * blocks to the existing storage
      */
     void forEach(FunctionType function) const override {}
+
+    /**
+     * Does not iterate any blocks - the same as forEach
+     */
+    bool forRange(shared_model::interface::types::HeightType from,
+                  shared_model::interface::types::HeightType to,
+                  RangeFunctionType function) const override {
+      return true;
+    }
   };
 
   /**
@@ -73,22 +82,18 @@ namespace {
       std::shared_ptr<iroha::ametsuchi::BlockQuery> &block_query) {
     // apply all blocks starting from the genesis
     auto top_height = block_query->getTopBlockHeight();
-    for (decltype(top_height) i = 1; i <= top_height; ++i) {
-      auto result = block_query->getBlock(i).match(
-          [&mutable_storage](
-              auto &&block) -> iroha::expected::Result<void, std::string> {
-            if (not mutable_storage->apply(std::move(block).value)) {
-              return iroha::expected::makeError("Cannot apply block!");
-            }
-            return iroha::expected::Value<void>();
-          },
-          [](auto &&err) -> iroha::expected::Result<void, std::string> {
-            return std::move(err).error.message;
-          });
+    bool applied = true;
+    auto result = block_query->forEachBlock(
+        1, top_height, [&mutable_storage, &applied](auto block) {
+          applied = mutable_storage->apply(std::move(block));
+          return applied;
+        });
 
-      if (auto e = iroha::expected::resultToOptionalError(result)) {
-        return std::move(e).value();
-      }
+    if (auto e = iroha::expected::resultToOptionalError(result)) {
+      return iroha::expected::makeError(std::move(e)->message);
+    }
+    if (not applied) {
+      return iroha::expected::makeError("Cannot apply block!");
     }
 
     return storage.commit(std::move(mutable_storage));
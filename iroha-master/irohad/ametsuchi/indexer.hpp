@@ -34,6 +34,11 @@ namespace iroha {
           const shared_model::interface::types::HashType &hash,
           TxPosition position) = 0;
 
+      /// Store serialized transaction by its position.
+      virtual void txBlobPosition(
+          const shared_model::interface::types::BlobType &tx_blob,
+          TxPosition position) = 0;
+
       /// Store a committed tx hash.
       virtual void committedTxHash(
           const shared_model::interface::types::HashType
@@ -52,7 +52,8 @@ namespace iroha {
           ClusterOrdering order,
           Round round,
           rxcpp::observe_on_one_worker worker,
-          logger::LoggerPtr log) {
+          logger::LoggerPtr log,
+          VoteDissemination dissemination) {
         return std::make_shared<Yac>(vote_storage,
                                      network,
                                      crypto,
@@ -60,7 +61,8 @@ namespace iroha {
                                      order,
                                      round,
                                      worker,
-                                     std::move(log));
+                                     std::move(log),
+                                     dissemination);
       }
 
       Yac::Yac(YacVoteStorage vote_storage,
@@ -70,7 +72,8 @@ namespace iroha {
                ClusterOrdering order,
                Round round,
                rxcpp::observe_on_one_worker worker,
-               logger::LoggerPtr log)
+               logger::LoggerPtr log,
+               VoteDissemination dissemination)
           : log_(std::move(log)),
             cluster_order_(order),
             round_(round),
@@ -79,7 +82,11 @@ namespace iroha {
             vote_storage_(std::move(vote_storage)),
             network_(std::move(network)),
             crypto_(std::move(crypto)),
-            timer_(std::move(timer)) {}
+            timer_(std::move(timer)),
+            dissemination_(dissemination),
+            round_duration_histogram_(metrics::defaultRegistry().histogram(
+                "iroha_yac_round_duration_seconds",
+                "Time from the own vote to the consensus outcome")) {}
 
       Yac::~Yac() {
         notifier_lifetime_.unsubscribe();
@@ -95,11 +102,19 @@ namespace iroha {
         std::unique_lock<std::mutex> lock(mutex_);
         cluster_order_ = order;
         round_ = hash.vote_round;
+        round_start_ = std::chrono::steady_clock::now();
         lock.unlock();
         auto vote = crypto_->getVote(hash);
         // TODO 10.06.2018 andrei: IR-1407 move YAC propagation strategy to a
         // separate entity
-        votingStep(vote);
+        switch (dissemination_) {
+          case VoteDissemination::kLeader:
+            votingStep(vote);
+            break;
+          case VoteDissemination::kBroadcast:
+            broadcastVote(vote);
+            break;
+        }
       }
 
       rxcpp::observable<Answer> Yac::onOutcome() {
@@ -121,8 +136,11 @@ namespace iroha {
       }
 
       /// moves the votes not present in known_keys from votes to return value
-      void Yac::removeUnknownPeersVotes(std::vector<VoteMessage> &votes) {
-        auto known_keys = cluster_order_.getPeers()
+      void Yac::removeUnknownPeersVotes(
+          std::vector<VoteMessage> &votes,
+          const std::vector<std::shared_ptr<shared_model::interface::Peer>>
+              &peers) {
+        auto known_keys = peers
             | boost::adaptors::transformed(
                               [](const auto &peer) { return peer->pubkey(); });
         removeMatching(
@@ -138,18 +156,24 @@ namespace iroha {
 
       void Yac::onState(std::vector<VoteMessage> state) {
         std::unique_lock<std::mutex> guard(mutex_);
+        auto peers = cluster_order_.getPeers();
+        guard.unlock();
 
-        removeUnknownPeersVotes(state);
+        // votes are filtered and verified without the lock, so that the
+        // states passed by the network workers are checked concurrently
+        removeUnknownPeersVotes(state, peers);
         if (state.empty()) {
           log_->debug("No votes left in the message.");
           return;
         }
 
-        if (crypto_->verify(state)) {
-          applyState(state, guard);
-        } else {
+        if (not crypto_->verify(state)) {
           log_->warn("{}", cryptoError(state));
+          return;
         }
+
+        guard.lock();
+        applyState(state, guard);
       }
 
       // ------|Private interface|------
@@ -162,7 +186,13 @@ namespace iroha {
           return;
         }
 
+        // the peers are kept alive if the order is changed while the vote is
+        // sent without the lock
+        auto peers = cluster_order_.getPeers();
         const auto &current_leader = cluster_order_.currentLeader();
+        cluster_order_.switchToNext();
+        auto has_next = cluster_order_.hasNext();
+        lock.unlock();
 
         log_->info("Vote for round {}, hash ({}, {}) to peer {}",
                    vote.hash.vote_round,
@@ -171,14 +201,35 @@ namespace iroha {
                    current_leader);
 
         network_->sendState(current_leader, {vote});
-        cluster_order_.switchToNext();
-        auto has_next = cluster_order_.hasNext();
-        lock.unlock();
         if (has_next) {
           timer_->invokeAfterDelay([this, vote] { this->votingStep(vote); });
         }
       }
 
+      void Yac::broadcastVote(VoteMessage vote) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        if (vote_storage_.isCommitted(vote.hash.vote_round)) {
+          return;
+        }
+        auto peers = cluster_order_.getPeers();
+        lock.unlock();
+
+        log_->info("Vote for round {}, hash ({}, {}) to all {} peers",
+                   vote.hash.vote_round,
+                   vote.hash.vote_hashes.proposal_hash,
+                   vote.hash.vote_hashes.block_hash,
+                   peers.size());
+
+        // every peer collects the votes, so a failed peer does not delay
+        // the commit; the network creates the missing connections under
+        // its own lock
+        for (const auto &peer : peers) {
+          propagateStateDirectly(*peer, {vote});
+        }
+        // the leaders are tried one by one only if the votes were lost
+        timer_->invokeAfterDelay([this, vote] { this->votingStep(vote); });
+      }
+
       void Yac::closeRound() {
         timer_->deny();
       }
@@ -199,6 +250,7 @@ namespace iroha {
       void Yac::applyState(const std::vector<VoteMessage> &state,
                            std::unique_lock<std::mutex> &lock) {
         assert(lock.owns_lock());
+        Outbox outbox;
         auto answer =
             vote_storage_.store(state, cluster_order_.getNumberOfPeers());
 
@@ -235,12 +287,13 @@ namespace iroha {
               auto votes = [](const auto &state) { return state.votes; };
 
               auto current_round = round_;
+              auto round_start = round_start_;
               switch (processing_state) {
                 case ProposalState::kNotSentNotProcessed:
                   vote_storage_.nextProcessingState(proposal_round);
                   log_->info("Propagate state {} to whole network",
                              proposal_round);
-                  this->propagateState(visit_in_place(answer, votes));
+                  this->propagateState(visit_in_place(answer, votes), outbox);
                   break;
                 case ProposalState::kSentNotProcessed:
                   vote_storage_.nextProcessingState(proposal_round);
@@ -249,21 +302,32 @@ namespace iroha {
                   if (proposal_round >= current_round) {
                     this->closeRound();
                   }
+                  if (proposal_round == current_round) {
+                    round_duration_histogram_.observe(
+                        std::chrono::duration<double>(
+                            std::chrono::steady_clock::now() - round_start)
+                            .count());
+                  }
                   notifier_.get_subscriber().on_next(answer);
                   break;
                 case ProposalState::kSentProcessed:
-                  this->tryPropagateBack(state);
+                  this->tryPropagateBack(state, outbox);
                   break;
               }
             },
             // sent a state which didn't match with current one
-            [&]() { this->tryPropagateBack(state); });
+            [&]() { this->tryPropagateBack(state, outbox); });
         if (lock.owns_lock()) {
           lock.unlock();
         }
+
+        for (const auto &message : outbox) {
+          this->propagateStateDirectly(*message.first, message.second);
+        }
       }
 
-      void Yac::tryPropagateBack(const std::vector<VoteMessage> &state) {
+      void Yac::tryPropagateBack(const std::vector<VoteMessage> &state,
+                                 Outbox &outbox) {
         // yac back propagation will work only if another peer is in
         // propagation stage because if peer sends list of votes this means that
         // state is already committed
@@ -279,8 +343,7 @@ namespace iroha {
                            last_round,
                            from->address());
                 auto votes = [](const auto &state) { return state.votes; };
-                this->propagateStateDirectly(*from,
-                                             visit_in_place(last_state, votes));
+                outbox.emplace_back(from, visit_in_place(last_state, votes));
               };
             };
           }
@@ -289,9 +352,10 @@ namespace iroha {
 
       // ------|Propagation|------
 
-      void Yac::propagateState(const std::vector<VoteMessage> &msg) {
+      void Yac::propagateState(const std::vector<VoteMessage> &msg,
+                               Outbox &outbox) {
         for (const auto &peer : cluster_order_.getPeers()) {
-          propagateStateDirectly(*peer, msg);
+          outbox.emplace_back(peer, msg);
         }
       }
 
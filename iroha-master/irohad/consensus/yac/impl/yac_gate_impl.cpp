@@ -17,6 +17,7 @@
 #include "interfaces/iroha_internal/block.hpp"
 #include "logger/logger.hpp"
 #include "simulator/block_creator.hpp"
+#include "tracing/tracer.hpp"
 
 namespace iroha {
   namespace consensus {
@@ -67,6 +68,7 @@ namespace iroha {
         }
 
         current_hash_ = hash_provider_->makeHash(event);
+        tracing::traceObject("voted", event.round);
 
         if (not event.round_data) {
           current_block_ = boost::none;
@@ -6,6 +6,7 @@
 #include "consensus/yac/transport/impl/network_impl.hpp"
 
 #include <grpc++/grpc++.h>
+#include <algorithm>
 #include <memory>
 
 #include "consensus/yac/storage/yac_common.hpp"
@@ -18,6 +19,9 @@
 namespace iroha {
   namespace consensus {
     namespace yac {
+      constexpr size_t NetworkImpl::kDefaultMaxPendingStates;
+      constexpr size_t NetworkImpl::kDefaultWorkers;
+
       // ----------| Public API |----------
 
       NetworkImpl::NetworkImpl(
@@ -25,10 +29,30 @@ namespace iroha {
               async_call,
           std::function<std::unique_ptr<proto::Yac::StubInterface>(
               const shared_model::interface::Peer &)> client_creator,
-          logger::LoggerPtr log)
+          logger::LoggerPtr log,
+          size_t max_pending_states,
+          size_t workers)
           : async_call_(async_call),
             client_creator_(client_creator),
-            log_(std::move(log)) {}
+            log_(std::move(log)),
+            max_pending_states_(std::max<size_t>(max_pending_states, 1)),
+            stop_(false) {
+        workers = std::max<size_t>(workers, 1);
+        for (size_t i = 0; i < workers; ++i) {
+          workers_.emplace_back([this] { processStates(); });
+        }
+      }
+
+      NetworkImpl::~NetworkImpl() {
+        {
+          std::lock_guard<std::mutex> lock(queue_mutex_);
+          stop_ = true;
+        }
+        queue_cv_.notify_all();
+        for (auto &worker : workers_) {
+          worker.join();
+        }
+      }
 
       void NetworkImpl::subscribe(
           std::shared_ptr<YacNetworkNotifications> handler) {
@@ -37,7 +61,7 @@ namespace iroha {
 
       void NetworkImpl::sendState(const shared_model::interface::Peer &to,
                                   const std::vector<VoteMessage> &state) {
-        createPeerConnection(to);
+        auto peer = createPeerConnection(to);
 
         proto::State request;
         for (const auto &vote : state) {
@@ -46,7 +70,7 @@ namespace iroha {
         }
 
         async_call_->Call([&](auto context, auto cq) {
-          return peers_.at(to.address())->AsyncSendState(context, request, cq);
+          return peer->AsyncSendState(context, request, cq);
         });
 
         log_->info(
@@ -76,19 +100,67 @@ namespace iroha {
         log_->info(
             "Received votes[size={}] from {}", state.size(), context->peer());
 
-        if (auto notifications = handler_.lock()) {
-          notifications->onState(std::move(state));
-        } else {
-          log_->error("Unable to lock the subscriber");
+        {
+          std::lock_guard<std::mutex> lock(queue_mutex_);
+          if (pending_states_.size() >= max_pending_states_) {
+            // all the votes of a state have the same round
+            auto oldest = std::min_element(
+                pending_states_.begin(),
+                pending_states_.end(),
+                [](const auto &lhs, const auto &rhs) {
+                  return lhs.front().hash.vote_round
+                      < rhs.front().hash.vote_round;
+                });
+            const auto &oldest_round = oldest->front().hash.vote_round;
+            if (not(oldest_round < state.front().hash.vote_round)) {
+              log_->warn("Votes from {} are dropped: {} states are pending",
+                         context->peer(),
+                         pending_states_.size());
+              return grpc::Status(grpc::StatusCode::RESOURCE_EXHAUSTED,
+                                  "Too many pending states");
+            }
+            log_->warn("Votes of round {} are dropped for the votes of {}",
+                       oldest_round,
+                       state.front().hash.vote_round);
+            pending_states_.erase(oldest);
+          }
+          pending_states_.push_back(std::move(state));
         }
+        queue_cv_.notify_one();
         return grpc::Status::OK;
       }
 
-      void NetworkImpl::createPeerConnection(
+      // ----------| Private API |----------
+
+      void NetworkImpl::processStates() {
+        std::unique_lock<std::mutex> lock(queue_mutex_);
+        while (true) {
+          queue_cv_.wait(
+              lock, [this] { return stop_ or not pending_states_.empty(); });
+          if (stop_) {
+            return;
+          }
+          auto state = std::move(pending_states_.front());
+          pending_states_.pop_front();
+
+          lock.unlock();
+          if (auto notifications = handler_.lock()) {
+            notifications->onState(std::move(state));
+          } else {
+            log_->error("Unable to lock the subscriber");
+          }
+          lock.lock();
+        }
+      }
+
+      proto::Yac::StubInterface *NetworkImpl::createPeerConnection(
           const shared_model::interface::Peer &peer) {
-        if (peers_.count(peer.address()) == 0) {
-          peers_[peer.address()] = client_creator_(peer);
+        std::lock_guard<std::mutex> lock(peers_mutex_);
+        auto &connection = peers_[peer.address()];
+        if (not connection) {
+          connection = client_creator_(peer);
         }
+        return connection.get();
       }
 
     }  // namespace yac
@@ -9,8 +9,13 @@
 #include "consensus/yac/transport/yac_network_interface.hpp"  // for YacNetwork
 #include "yac.grpc.pb.h"
 
+#include <condition_variable>
+#include <deque>
 #include <memory>
+#include <mutex>
+#include <thread>
 #include <unordered_map>
+#include <vector>
 
 #include "consensus/yac/outcome_messages.hpp"
 #include "consensus/yac/vote_message.hpp"
@@ -25,16 +30,37 @@ namespace iroha {
 
       /**
        * Class which provides implementation of transport for consensus based on
-       * grpc
+       * grpc. Received states are passed to the subscriber by a pool of
+       * workers, so that grpc threads are not held while votes are processed
+       * and the states of different peers are verified concurrently.
+       *
+       * When the queue is full, the states of the oldest round are dropped
+       * first, so the states of the current round are kept. A dropped state
+       * is not resent by its sender. A peer which misses the votes of a round
+       * learns the outcome from the commit of the other peers, or from a
+       * state of a later round, and then synchronizes the missing block.
        */
       class NetworkImpl : public YacNetwork, public proto::Yac::Service {
        public:
-        explicit NetworkImpl(
+        /**
+         * @param async_call - client for outgoing calls
+         * @param client_creator - creates a stub for the given peer
+         * @param log - logger
+         * @param max_pending_states - maximum number of received states
+         * waiting for the workers
+         * @param workers - number of threads passing the states to the
+         * subscriber
+         */
+        NetworkImpl(
             std::shared_ptr<network::AsyncGrpcClient<google::protobuf::Empty>>
                 async_call,
             std::function<std::unique_ptr<proto::Yac::StubInterface>(
                 const shared_model::interface::Peer &)> client_creator,
-            logger::LoggerPtr log);
+            logger::LoggerPtr log,
+            size_t max_pending_states = kDefaultMaxPendingStates,
+            size_t workers = kDefaultWorkers);
+
+        ~NetworkImpl() override;
 
         void subscribe(
             std::shared_ptr<YacNetworkNotifications> handler) override;
@@ -46,19 +72,32 @@ namespace iroha {
          * Receive votes from another peer;
          * Naming is confusing, because this is rpc call that
          * perform on another machine;
+         * Votes are validated and queued for the workers. If the queue is
+         * full, the queued state of the oldest round is dropped for a state
+         * of a later round, otherwise RESOURCE_EXHAUSTED is returned
          */
         grpc::Status SendState(
             ::grpc::ServerContext *context,
             const ::iroha::consensus::yac::proto::State *request,
             ::google::protobuf::Empty *response) override;
 
+        static constexpr size_t kDefaultMaxPendingStates = 1024;
+        static constexpr size_t kDefaultWorkers = 4;
+
        private:
+        /**
+         * Pass queued states to the subscriber until the network is destroyed
+         */
+        void processStates();
+
         /**
          * Create GRPC connection for given peer if it does not exist in
          * peers map
          * @param peer to instantiate connection with
+         * @return connection to the peer, which lives as long as the network
          */
-        void createPeerConnection(const shared_model::interface::Peer &peer);
+        proto::Yac::StubInterface *createPeerConnection(
+            const shared_model::interface::Peer &peer);
 
         /**
          * Mapping of peer objects to connections
@@ -66,6 +105,9 @@ namespace iroha {
         std::unordered_map<shared_model::interface::types::AddressType,
                            std::unique_ptr<proto::Yac::StubInterface>>
             peers_;
+        /// States are sent from several threads, so the connections are
+        /// looked up and created under the lock
+        std::mutex peers_mutex_;
 
         /**
          * Subscriber of network messages
@@ -86,6 +128,17 @@ namespace iroha {
             client_creator_;
 
         logger::LoggerPtr log_;
+
+        const size_t max_pending_states_;
+
+        /**
+         * Received states waiting for the workers
+         */
+        std::deque<std::vector<VoteMessage>> pending_states_;
+        bool stop_;
+        std::mutex queue_mutex_;
+        std::condition_variable queue_cv_;
+        std::vector<std::thread> workers_;
       };
 
     }  // namespace yac
@@ -38,7 +38,9 @@ namespace iroha {
             std::shared_ptr<YacNetworkNotifications> handler) = 0;
 
         /**
-         * Directly share collection of votes
+         * Directly share collection of votes. Yac calls it without its lock,
+         * concurrently from the voting thread, the timer and the network
+         * workers, so implementations must be thread-safe
          * @param to - peer recipient
          * @param state - message for sending
          */
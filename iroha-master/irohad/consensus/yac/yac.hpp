@@ -9,15 +9,20 @@
 #include "consensus/yac/transport/yac_network_interface.hpp"  // for YacNetworkNotifications
 #include "consensus/yac/yac_gate.hpp"                         // for HashGate
 
+#include <chrono>
 #include <memory>
 #include <mutex>
+#include <utility>
+#include <vector>
 
 #include <boost/optional.hpp>
 #include <rxcpp/rx.hpp>
 #include "consensus/yac/cluster_order.hpp"     //  for ClusterOrdering
 #include "consensus/yac/outcome_messages.hpp"  // because messages passed by value
 #include "consensus/yac/storage/yac_vote_storage.hpp"  // for VoteStorage
+#include "consensus/yac/yac_types.hpp"  // for VoteDissemination
 #include "logger/logger_fwd.hpp"
+#include "metrics/metrics.hpp"
 
 namespace iroha {
   namespace consensus {
@@ -31,6 +36,7 @@ namespace iroha {
         /**
          * Method for creating Yac consensus object
          * @param delay for timer in milliseconds
+         * @param dissemination - way of sending own votes
          */
         static std::shared_ptr<Yac> create(
             YacVoteStorage vote_storage,
@@ -40,7 +46,8 @@ namespace iroha {
             ClusterOrdering order,
             Round round,
             rxcpp::observe_on_one_worker worker,
-            logger::LoggerPtr log);
+            logger::LoggerPtr log,
+            VoteDissemination dissemination = VoteDissemination::kLeader);
 
         Yac(YacVoteStorage vote_storage,
             std::shared_ptr<YacNetwork> network,
@@ -49,7 +56,8 @@ namespace iroha {
             ClusterOrdering order,
             Round round,
             rxcpp::observe_on_one_worker worker,
-            logger::LoggerPtr log);
+            logger::LoggerPtr log,
+            VoteDissemination dissemination = VoteDissemination::kLeader);
 
         ~Yac() override;
 
@@ -64,6 +72,11 @@ namespace iroha {
         void onState(std::vector<VoteMessage> state) override;
 
        private:
+        /// States to send to the peers once the mutex is released
+        using Outbox = std::vector<
+            std::pair<std::shared_ptr<shared_model::interface::Peer>,
+                      std::vector<VoteMessage>>>;
+
         // ------|Private interface|------
 
         /**
@@ -72,6 +85,12 @@ namespace iroha {
          */
         void votingStep(VoteMessage vote);
 
+        /**
+         * Send the vote to all peers, and fall back to the voting steps if
+         * the round is not committed after the delay
+         */
+        void broadcastVote(VoteMessage vote);
+
         /**
          * Erase temporary data of current round
          */
@@ -85,11 +104,17 @@ namespace iroha {
         boost::optional<std::shared_ptr<shared_model::interface::Peer>>
         findPeer(const VoteMessage &vote);
 
-        /// Remove votes from unknown peers from given vector.
-        void removeUnknownPeersVotes(std::vector<VoteMessage> &votes);
+        /// Remove votes from peers not present in given peers from given
+        /// vector.
+        void removeUnknownPeersVotes(
+            std::vector<VoteMessage> &votes,
+            const std::vector<std::shared_ptr<shared_model::interface::Peer>>
+                &peers);
 
         // ------|Apply data|------
         /**
+         * Update the vote storage with the state and send the resulting
+         * messages to the peers after the lock is released
          * @pre lock is locked
          * @post lock is unlocked
          */
@@ -97,19 +122,25 @@ namespace iroha {
                         std::unique_lock<std::mutex> &lock);
 
         // ------|Propagation|------
-        void propagateState(const std::vector<VoteMessage> &msg);
+        void propagateState(const std::vector<VoteMessage> &msg,
+                            Outbox &outbox);
         void propagateStateDirectly(const shared_model::interface::Peer &to,
                                     const std::vector<VoteMessage> &msg);
-        void tryPropagateBack(const std::vector<VoteMessage> &state);
+        void tryPropagateBack(const std::vector<VoteMessage> &state,
+                              Outbox &outbox);
 
         // ------|Logger|------
         logger::LoggerPtr log_;
 
+        /// Guards the round data and the vote storage, crypto verification
+        /// and network calls are performed without it
         std::mutex mutex_;
 
         // ------|One round|------
         ClusterOrdering cluster_order_;
         Round round_;
+        /// Time of the own vote for round_
+        std::chrono::steady_clock::time_point round_start_;
 
         // ------|Fields|------
         rxcpp::observe_on_one_worker worker_;
@@ -119,6 +150,11 @@ namespace iroha {
         std::shared_ptr<YacNetwork> network_;
         std::shared_ptr<YacCryptoProvider> crypto_;
         std::shared_ptr<Timer> timer_;
+        const VoteDissemination dissemination_;
+
+        // ------|Metrics|------
+        /// Time from the own vote to the outcome of the round
+        metrics::Histogram &round_duration_histogram_;
       };
     }  // namespace yac
   }    // namespace consensus
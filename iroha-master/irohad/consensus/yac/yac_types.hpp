@@ -15,6 +15,16 @@ namespace iroha {
       /// Type for number of peers in round.
       using PeersNumberType = size_t;
 
+      /// Way of sending own votes to the other peers
+      enum class VoteDissemination {
+        /// the vote is sent to the current leader, the next peer is tried
+        /// after the vote delay
+        kLeader,
+        /// the vote is sent to all peers at once, the leaders are tried one
+        /// by one after the vote delay if the round is not committed
+        kBroadcast
+      };
+
     }  // namespace yac
   }    // namespace consensus
 }  // namespace iroha
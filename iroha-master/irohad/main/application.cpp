@@ -80,6 +80,7 @@ static constexpr iroha::consensus::yac::ConsistencyModel
  * Configuring iroha daemon
  */
 Irohad::Irohad(const boost::optional<std::string> &block_store_dir,
+               ametsuchi::FlatFileOptions block_store_options,
                std::unique_ptr<ametsuchi::PostgresOptions> pg_opt,
                const std::string &listen_ip,
                size_t torii_port,
@@ -87,26 +88,37 @@ Irohad::Irohad(const boost::optional<std::string> &block_store_dir,
                size_t max_proposal_size,
                std::chrono::milliseconds proposal_delay,
                std::chrono::milliseconds vote_delay,
+               consensus::yac::VoteDissemination vote_dissemination,
                std::chrono::minutes mst_expiration_time,
                const shared_model::crypto::Keypair &keypair,
                std::chrono::milliseconds max_rounds_delay,
                size_t stale_stream_max_rounds,
+               size_t max_pending_batches,
+               std::chrono::milliseconds tx_ttl,
+               iroha::ordering::ProposalBudget proposal_budget,
+               iroha::torii::AdmissionLimits admission_limits,
                boost::optional<shared_model::interface::types::PeerList>
                    opt_alternative_peers,
                logger::LoggerManagerTreePtr logger_manager,
                const boost::optional<GossipPropagationStrategyParams>
                    &opt_mst_gossip_params)
     : block_store_dir_(block_store_dir),
+      block_store_options_(std::move(block_store_options)),
       listen_ip_(listen_ip),
       torii_port_(torii_port),
       internal_port_(internal_port),
       max_proposal_size_(max_proposal_size),
       proposal_delay_(proposal_delay),
       vote_delay_(vote_delay),
+      vote_dissemination_(vote_dissemination),
       is_mst_supported_(opt_mst_gossip_params),
       mst_expiration_time_(mst_expiration_time),
       max_rounds_delay_(max_rounds_delay),
       stale_stream_max_rounds_(stale_stream_max_rounds),
+      max_pending_batches_(max_pending_batches),
+      tx_ttl_(tx_ttl),
+      proposal_budget_(std::move(proposal_budget)),
+      admission_limits_(admission_limits),
       opt_alternative_peers_(std::move(opt_alternative_peers)),
       opt_mst_gossip_params_(opt_mst_gossip_params),
       keypair(keypair),
@@ -232,8 +244,10 @@ Irohad::RunResult Irohad::initStorage(
 
   std::unique_ptr<BlockStorage> persistent_block_storage;
   if (block_store_dir_) {
-    auto flat_file = FlatFile::create(
-        *block_store_dir_, log_manager_->getChild("FlatFile")->getLogger());
+    auto flat_file =
+        FlatFile::create(*block_store_dir_,
+                         log_manager_->getChild("FlatFile")->getLogger(),
+                         block_store_options_);
     if (not flat_file) {
       return expected::makeError(
           "Unable to create FlatFile for persistent storage");
@@ -500,6 +514,9 @@ Irohad::RunResult Irohad::initOrderingGate() {
 
   ordering_gate =
       ordering_init.initOrderingGate(max_proposal_size_,
+                                     max_pending_batches_,
+                                     tx_ttl_,
+                                     proposal_budget_,
                                      proposal_delay_,
                                      std::move(hashes),
                                      transaction_factory,
@@ -593,6 +610,7 @@ Irohad::RunResult Irohad::initConsensusGate() {
       keypair,
       consensus_result_cache_,
       vote_delay_,
+      vote_dissemination_,
       async_call_,
       kConsensusConsistencyModel,
       log_manager_->getChild("Consensus"));
@@ -757,6 +775,10 @@ Irohad::RunResult Irohad::initTransactionCommandService() {
           transaction_factory,
           batch_parser,
           transaction_batch_factory_,
+          std::make_shared<::torii::AdmissionControl>(
+              admission_limits_,
+              command_service_log_manager->getChild("AdmissionControl")
+                  ->getLogger()),
           consensus_gate_objects.get_observable().map([](const auto &) {
             return ::torii::CommandServiceTransportGrpc::ConsensusGateEvent{};
           }),
@@ -6,8 +6,10 @@
 #ifndef IROHA_APPLICATION_HPP
 #define IROHA_APPLICATION_HPP
 
+#include "ametsuchi/impl/flat_file/flat_file_options.hpp"
 #include "consensus/consensus_block_cache.hpp"
 #include "consensus/gate_object.hpp"
+#include "consensus/yac/yac_types.hpp"
 #include "cryptography/crypto_provider/abstract_crypto_model_signer.hpp"
 #include "cryptography/keypair.hpp"
 #include "interfaces/queries/blocks_query.hpp"
@@ -17,6 +19,7 @@
 #include "main/impl/block_loader_init.hpp"
 #include "main/impl/on_demand_ordering_init.hpp"
 #include "multi_sig_transactions/gossip_propagation_strategy_params.hpp"
+#include "torii/impl/admission_control.hpp"
 
 namespace iroha {
   class PendingTransactionStorage;
@@ -79,6 +82,8 @@ class Irohad {
   /**
    * Constructor that initializes common iroha pipeline
    * @param block_store_dir - folder where blocks will be stored
+   * @param block_store_options - sync and compression parameters of the
+   * block store folder
    * @param pg_opt - connection options for PostgresSQL
    * @param listen_ip - ip address for opening ports (internal & torii)
    * @param torii_port - port for torii binding
@@ -88,6 +93,7 @@ class Irohad {
    * one proposal
    * @param proposal_delay - maximum waiting time util emitting new proposal
    * @param vote_delay - waiting time before sending vote to next peer
+   * @param vote_dissemination - way of sending own votes to the peers
    * @param mst_expiration_time - maximum time until until MST transaction is
    * not considered as expired (in minutes)
    * @param keypair - public and private keys for crypto signer
@@ -95,6 +101,13 @@ class Irohad {
    * transactions
    * @param stale_stream_max_rounds - maximum number of rounds between
    * consecutive status emissions
+   * @param max_pending_batches - maximum number of batches waiting for a
+   * proposal in ordering service, 0 means no limit
+   * @param tx_ttl - time since creation after which transactions are dropped
+   * from ordering, 0 means no expiration
+   * @param proposal_budget - limits of proposal size in bytes, commands and
+   * estimated execution cost
+   * @param admission_limits - rate limits of transactions accepted by Torii
    * @param opt_alternative_peers - optional alternative initial peers list
    * @param logger_manager - the logger manager to use
    * @param opt_mst_gossip_params - parameters for Gossip MST propagation
@@ -102,6 +115,7 @@ class Irohad {
    * TODO mboldyrev 03.11.2018 IR-1844 Refactor the constructor.
    */
   Irohad(const boost::optional<std::string> &block_store_dir,
+         iroha::ametsuchi::FlatFileOptions block_store_options,
          std::unique_ptr<iroha::ametsuchi::PostgresOptions> pg_opt,
          const std::string &listen_ip,
          size_t torii_port,
@@ -109,10 +123,15 @@ class Irohad {
          size_t max_proposal_size,
          std::chrono::milliseconds proposal_delay,
          std::chrono::milliseconds vote_delay,
+         iroha::consensus::yac::VoteDissemination vote_dissemination,
          std::chrono::minutes mst_expiration_time,
          const shared_model::crypto::Keypair &keypair,
          std::chrono::milliseconds max_rounds_delay,
          size_t stale_stream_max_rounds,
+         size_t max_pending_batches,
+         std::chrono::milliseconds tx_ttl,
+         iroha::ordering::ProposalBudget proposal_budget,
+         iroha::torii::AdmissionLimits admission_limits,
          boost::optional<shared_model::interface::types::PeerList>
              opt_alternative_peers,
          logger::LoggerManagerTreePtr logger_manager,
@@ -199,16 +218,22 @@ class Irohad {
 
   // constructor dependencies
   const boost::optional<std::string> block_store_dir_;
+  const iroha::ametsuchi::FlatFileOptions block_store_options_;
   const std::string listen_ip_;
   size_t torii_port_;
   size_t internal_port_;
   size_t max_proposal_size_;
   std::chrono::milliseconds proposal_delay_;
   std::chrono::milliseconds vote_delay_;
+  iroha::consensus::yac::VoteDissemination vote_dissemination_;
   bool is_mst_supported_;
   std::chrono::minutes mst_expiration_time_;
   std::chrono::milliseconds max_rounds_delay_;
   size_t stale_stream_max_rounds_;
+  size_t max_pending_batches_;
+  std::chrono::milliseconds tx_ttl_;
+  iroha::ordering::ProposalBudget proposal_budget_;
+  iroha::torii::AdmissionLimits admission_limits_;
   const boost::optional<shared_model::interface::types::PeerList>
       opt_alternative_peers_;
   boost::optional<iroha::GossipPropagationStrategyParams>
@@ -45,6 +45,7 @@ namespace {
       std::shared_ptr<YacNetwork> network,
       ConsistencyModel consistency_model,
       rxcpp::observe_on_one_worker coordination,
+      VoteDissemination vote_dissemination,
       const logger::LoggerManagerTreePtr &consensus_log_manager) {
     std::shared_ptr<iroha::consensus::yac::CleanupStrategy> cleanup_strategy =
         std::make_shared<iroha::consensus::yac::BufferedCleanupStrategy>();
@@ -58,7 +59,8 @@ namespace {
         initial_order,
         initial_round,
         coordination,
-        consensus_log_manager->getChild("HashGate")->getLogger());
+        consensus_log_manager->getChild("HashGate")->getLogger(),
+        vote_dissemination);
   }
 }  // namespace
 
@@ -90,6 +92,7 @@ namespace iroha {
           std::shared_ptr<consensus::ConsensusResultCache>
               consensus_result_cache,
           std::chrono::milliseconds vote_delay_milliseconds,
+          VoteDissemination vote_dissemination,
           std::shared_ptr<
               iroha::network::AsyncGrpcClient<google::protobuf::Empty>>
               async_call,
@@ -113,6 +116,7 @@ namespace iroha {
                              consensus_network_,
                              consistency_model,
                              rxcpp::observe_on_new_thread(),
+                             vote_dissemination,
                              consensus_log_manager);
         consensus_network_->subscribe(yac);
 
@@ -38,6 +38,7 @@ namespace iroha {
             const shared_model::crypto::Keypair &keypair,
             std::shared_ptr<consensus::ConsensusResultCache> block_cache,
             std::chrono::milliseconds vote_delay_milliseconds,
+            VoteDissemination vote_dissemination,
             std::shared_ptr<
                 iroha::network::AsyncGrpcClient<google::protobuf::Empty>>
                 async_call,
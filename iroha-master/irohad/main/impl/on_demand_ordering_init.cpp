@@ -199,6 +199,7 @@ namespace iroha {
         std::function<std::chrono::milliseconds(
             const synchronizer::SynchronizationEvent &)> delay_func,
         size_t max_number_of_transactions,
+        std::chrono::milliseconds tx_ttl,
         const logger::LoggerManagerTreePtr &ordering_log_manager) {
       return std::make_shared<ordering::OnDemandOrderingGate>(
           std::move(ordering_service),
@@ -286,17 +287,24 @@ namespace iroha {
           std::move(proposal_factory),
           std::move(tx_cache),
           max_number_of_transactions,
+          tx_ttl,
           ordering_log_manager->getChild("Gate")->getLogger());
     }
 
     auto OnDemandOrderingInit::createService(
         size_t max_number_of_transactions,
+        size_t max_pending_batches,
+        std::chrono::milliseconds tx_ttl,
+        ordering::ProposalBudget proposal_budget,
         std::shared_ptr<shared_model::interface::UnsafeProposalFactory>
             proposal_factory,
         std::shared_ptr<ametsuchi::TxPresenceCache> tx_cache,
         const logger::LoggerManagerTreePtr &ordering_log_manager) {
       return std::make_shared<ordering::OnDemandOrderingServiceImpl>(
           max_number_of_transactions,
+          max_pending_batches,
+          tx_ttl,
+          std::move(proposal_budget),
           std::move(proposal_factory),
           std::move(tx_cache),
           ordering_log_manager->getChild("Service")->getLogger());
@@ -310,6 +318,9 @@ namespace iroha {
     std::shared_ptr<iroha::network::OrderingGate>
     OnDemandOrderingInit::initOrderingGate(
         size_t max_number_of_transactions,
+        size_t max_pending_batches,
+        std::chrono::milliseconds tx_ttl,
+        ordering::ProposalBudget proposal_budget,
         std::chrono::milliseconds delay,
         std::vector<shared_model::interface::types::HashType> initial_hashes,
         std::shared_ptr<
@@ -329,6 +340,9 @@ namespace iroha {
             const synchronizer::SynchronizationEvent &)> delay_func,
         logger::LoggerManagerTreePtr ordering_log_manager) {
       auto ordering_service = createService(max_number_of_transactions,
+                                            max_pending_batches,
+                                            tx_ttl,
+                                            std::move(proposal_budget),
                                             proposal_factory,
                                             tx_cache,
                                             ordering_log_manager);
@@ -350,6 +364,7 @@ namespace iroha {
           std::move(tx_cache),
           std::move(delay_func),
           max_number_of_transactions,
+          tx_ttl,
           ordering_log_manager);
     }
 
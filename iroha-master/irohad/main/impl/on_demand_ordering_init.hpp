@@ -19,6 +19,7 @@
 #include "ordering.grpc.pb.h"
 #include "ordering/impl/on_demand_os_server_grpc.hpp"
 #include "ordering/impl/ordering_gate_cache/ordering_gate_cache.hpp"
+#include "ordering/impl/proposal_packing_policy.hpp"
 #include "ordering/on_demand_ordering_service.hpp"
 #include "ordering/on_demand_os_transport.hpp"
 
@@ -74,6 +75,7 @@ namespace iroha {
           std::function<std::chrono::milliseconds(
               const synchronizer::SynchronizationEvent &)> delay_func,
           size_t max_number_of_transactions,
+          std::chrono::milliseconds tx_ttl,
           const logger::LoggerManagerTreePtr &ordering_log_manager);
 
       /**
@@ -82,6 +84,9 @@ namespace iroha {
        */
       auto createService(
           size_t max_number_of_transactions,
+          size_t max_pending_batches,
+          std::chrono::milliseconds tx_ttl,
+          ordering::ProposalBudget proposal_budget,
           std::shared_ptr<shared_model::interface::UnsafeProposalFactory>
               proposal_factory,
           std::shared_ptr<ametsuchi::TxPresenceCache> tx_cache,
@@ -102,6 +107,12 @@ namespace iroha {
        *
        * @param max_number_of_transactions maximum number of transactions in a
        * proposal
+       * @param max_pending_batches maximum number of batches waiting for a
+       * proposal in ordering service, 0 means no limit
+       * @param tx_ttl time since creation after which transactions are
+       * dropped from ordering, 0 means no expiration
+       * @param proposal_budget limits of proposal size in bytes, commands and
+       * estimated execution cost
        * @param delay timeout for ordering service response on proposal request
        * @param initial_hashes seeds for peer list permutations for first k
        * rounds they are required since hash of block i defines round i + k
@@ -119,6 +130,9 @@ namespace iroha {
        */
       std::shared_ptr<network::OrderingGate> initOrderingGate(
           size_t max_number_of_transactions,
+          size_t max_pending_batches,
+          std::chrono::milliseconds tx_ttl,
+          ordering::ProposalBudget proposal_budget,
           std::chrono::milliseconds delay,
           std::vector<shared_model::interface::types::HashType> initial_hashes,
           std::shared_ptr<
@@ -154,6 +154,38 @@ PgConnectionInit::createDatabaseIfNotExist(const PostgresOptions &pg_opt) {
   };
 }
 
+iroha::expected::Result<bool, std::string>
+PgConnectionInit::migrateAccountDetails(const PostgresOptions &pg_opt) {
+  return checkIfWorkingDatabaseExists(pg_opt) |
+             [&pg_opt](
+                 bool db_exists) -> iroha::expected::Result<bool, std::string> {
+    if (not db_exists) {
+      return expected::makeValue(false);
+    }
+    try {
+      soci::session sql(*soci::factory_postgresql(),
+                        pg_opt.workingConnectionString());
+      int has_data_column = 0;
+      sql << "SELECT count(1) FROM information_schema.columns "
+             "WHERE table_schema = current_schema() "
+             "AND table_name = 'account' AND column_name = 'data'",
+          soci::into(has_data_column);
+      if (has_data_column == 0) {
+        return expected::makeValue(false);
+      }
+
+      soci::transaction tx(sql);
+      sql << migrate_account_details_;
+      tx.commit();
+      return expected::makeValue(true);
+    } catch (std::exception &e) {
+      return expected::makeError<std::string>(
+          std::string("Failed to migrate account details: ")
+          + formatPostgresMessage(e.what()));
+    }
+  };
+}
+
 template <typename RollbackFunction>
 void PgConnectionInit::initializeConnectionPool(
     soci::connection_pool &connection_pool,
@@ -177,6 +209,7 @@ void PgConnectionInit::initializeConnectionPool(
     // IR-464
     on_init_db(session);
     PostgresCommandExecutor::prepareStatements(session);
+    PostgresQueryExecutor::prepareStatements(session);
   };
 
   /// lambda contains special actions which should be execute once
@@ -216,6 +249,24 @@ void PgConnectionInit::initializeConnectionPool(
   }
 }
 
+const std::string PgConnectionInit::migrate_account_details_ = R"(
+CREATE TABLE IF NOT EXISTS account_has_detail (
+    account_id character varying(288) NOT NULL REFERENCES account,
+    writer character varying(288) NOT NULL,
+    key character varying(64) NOT NULL,
+    value text NOT NULL,
+    PRIMARY KEY (account_id, writer, key)
+);
+INSERT INTO account_has_detail(account_id, writer, key, value)
+  SELECT account.account_id, data_by_writer.key, plain_data.key,
+         plain_data.value #>> '{}'
+  FROM account,
+       jsonb_each(account.data) data_by_writer,
+       jsonb_each(data_by_writer.value) plain_data
+  ON CONFLICT DO NOTHING;
+ALTER TABLE account RENAME COLUMN data TO data_before_account_has_detail;
+)";
+
 const std::string PgConnectionInit::init_ = R"(
 CREATE TABLE IF NOT EXISTS role (
     role_id character varying(32),
@@ -234,9 +285,30 @@ CREATE TABLE IF NOT EXISTS account (
     account_id character varying(288),
     domain_id character varying(255) NOT NULL REFERENCES domain,
     quorum int NOT NULL,
-    data JSONB,
     PRIMARY KEY (account_id)
 );
+CREATE TABLE IF NOT EXISTS account_has_detail (
+    account_id character varying(288) NOT NULL REFERENCES account,
+    writer character varying(288) NOT NULL,
+    key character varying(64) NOT NULL,
+    value text NOT NULL,
+    PRIMARY KEY (account_id, writer, key)
+);
+CREATE INDEX IF NOT EXISTS account_has_detail_key_index
+  ON account_has_detail
+  USING btree
+  (account_id, key, writer);
+DO $$
+BEGIN
+  IF EXISTS (SELECT 1 FROM information_schema.columns
+             WHERE table_schema = current_schema()
+               AND table_name = 'account' AND column_name = 'data') THEN
+    RAISE EXCEPTION USING MESSAGE =
+      'Account details are stored in the account.data column '
+      || 'of the previous schema, run irohad once with '
+      || '--migrate_account_details to move them to account_has_detail';
+  END IF;
+END $$;
 CREATE TABLE IF NOT EXISTS account_has_signatory (
     account_id character varying(288) NOT NULL REFERENCES account,
     public_key varchar NOT NULL REFERENCES signatory,
@@ -259,6 +331,72 @@ CREATE TABLE IF NOT EXISTS account_has_asset (
     amount decimal NOT NULL,
     PRIMARY KEY (account_id, asset_id)
 );
+DO $$
+BEGIN
+  IF to_regclass('account_asset_count') IS NULL THEN
+    CREATE TABLE account_asset_count (
+        account_id character varying(288),
+        count bigint NOT NULL,
+        PRIMARY KEY (account_id)
+    );
+    INSERT INTO account_asset_count(account_id, count)
+      SELECT account_id, count(1) FROM account_has_asset GROUP BY account_id;
+  END IF;
+  IF to_regclass('account_detail_count') IS NULL THEN
+    CREATE TABLE account_detail_count (
+        account_id character varying(288),
+        writer character varying(288),
+        count bigint NOT NULL,
+        PRIMARY KEY (account_id, writer)
+    );
+    INSERT INTO account_detail_count(account_id, writer, count)
+      SELECT account_id, writer, count(1) FROM account_has_detail
+      GROUP BY account_id, writer;
+  END IF;
+END $$;
+CREATE OR REPLACE FUNCTION count_account_asset() RETURNS trigger AS $$
+BEGIN
+  IF TG_OP = 'INSERT' THEN
+    INSERT INTO account_asset_count(account_id, count)
+      VALUES (NEW.account_id, 1)
+      ON CONFLICT (account_id)
+      DO UPDATE SET count = account_asset_count.count + 1;
+    RETURN NEW;
+  END IF;
+  UPDATE account_asset_count SET count = count - 1
+    WHERE account_id = OLD.account_id;
+  RETURN OLD;
+END;
+$$ LANGUAGE plpgsql;
+CREATE OR REPLACE FUNCTION count_account_detail() RETURNS trigger AS $$
+BEGIN
+  IF TG_OP = 'INSERT' THEN
+    INSERT INTO account_detail_count(account_id, writer, count)
+      VALUES (NEW.account_id, NEW.writer, 1)
+      ON CONFLICT (account_id, writer)
+      DO UPDATE SET count = account_detail_count.count + 1;
+    RETURN NEW;
+  END IF;
+  UPDATE account_detail_count SET count = count - 1
+    WHERE account_id = OLD.account_id AND writer = OLD.writer;
+  RETURN OLD;
+END;
+$$ LANGUAGE plpgsql;
+DO $$
+BEGIN
+  IF NOT EXISTS (SELECT 1 FROM pg_trigger
+                 WHERE tgname = 'account_has_asset_count') THEN
+    CREATE TRIGGER account_has_asset_count
+      AFTER INSERT OR DELETE ON account_has_asset
+      FOR EACH ROW EXECUTE PROCEDURE count_account_asset();
+  END IF;
+  IF NOT EXISTS (SELECT 1 FROM pg_trigger
+                 WHERE tgname = 'account_has_detail_count') THEN
+    CREATE TRIGGER account_has_detail_count
+      AFTER INSERT OR DELETE ON account_has_detail
+      FOR EACH ROW EXECUTE PROCEDURE count_account_detail();
+  END IF;
+END $$;
 CREATE TABLE IF NOT EXISTS role_has_permissions (
     role_id character varying(32) NOT NULL REFERENCES role,
     permission bit()"
@@ -284,6 +422,12 @@ CREATE TABLE IF NOT EXISTS position_by_hash (
     height bigint,
     index bigint
 );
+CREATE TABLE IF NOT EXISTS tx_data_by_position (
+    height bigint,
+    index bigint,
+    data bytea NOT NULL,
+    PRIMARY KEY (height, index)
+);
 CREATE TABLE IF NOT EXISTS tx_status_by_hash (
     hash varchar,
     status boolean
@@ -318,6 +462,9 @@ iroha::expected::Result<void, std::string> PgConnectionInit::resetWsv(
       TRUNCATE TABLE role_has_permissions RESTART IDENTITY CASCADE;
       TRUNCATE TABLE account_has_roles RESTART IDENTITY CASCADE;
       TRUNCATE TABLE account_has_grantable_permissions RESTART IDENTITY CASCADE;
+      TRUNCATE TABLE account_has_detail RESTART IDENTITY CASCADE;
+      TRUNCATE TABLE account_asset_count RESTART IDENTITY CASCADE;
+      TRUNCATE TABLE account_detail_count RESTART IDENTITY CASCADE;
       TRUNCATE TABLE account RESTART IDENTITY CASCADE;
       TRUNCATE TABLE asset RESTART IDENTITY CASCADE;
       TRUNCATE TABLE domain RESTART IDENTITY CASCADE;
@@ -325,6 +472,7 @@ iroha::expected::Result<void, std::string> PgConnectionInit::resetWsv(
       TRUNCATE TABLE peer RESTART IDENTITY CASCADE;
       TRUNCATE TABLE role RESTART IDENTITY CASCADE;
       TRUNCATE TABLE position_by_hash RESTART IDENTITY CASCADE;
+      TRUNCATE TABLE tx_data_by_position RESTART IDENTITY CASCADE;
       TRUNCATE TABLE tx_status_by_hash RESTART IDENTITY CASCADE;
       TRUNCATE TABLE tx_position_by_creator RESTART IDENTITY CASCADE;
       TRUNCATE TABLE position_by_account_asset RESTART IDENTITY CASCADE;
@@ -17,6 +17,7 @@
 #include "ametsuchi/impl/pool_wrapper.hpp"
 #include "ametsuchi/impl/postgres_command_executor.hpp"
 #include "ametsuchi/impl/postgres_options.hpp"
+#include "ametsuchi/impl/postgres_query_executor.hpp"
 #include "ametsuchi/reconnection_strategy.hpp"
 #include "common/result.hpp"
 #include "interfaces/permissions.hpp"
@@ -83,6 +84,19 @@ namespace iroha {
        */
       static expected::Result<void, std::string> resetPeers(soci::session &sql);
 
+      /**
+       * Move the account details from the account.data column of the previous
+       * schema to the account_has_detail table. The column is renamed to
+       * data_before_account_has_detail and kept, so that the migration can be
+       * rolled back by renaming it back, losing the details changed since.
+       * @param pg_opt Database options.
+       * @return Result of bool that is true if the details were migrated and
+       * false if there was nothing to migrate, or error message if the
+       * migration has failed and nothing was changed.
+       */
+      static expected::Result<bool, std::string> migrateAccountDetails(
+          const PostgresOptions &pg_opt);
+
      private:
       /**
        * Function initializes existing connection pool
@@ -110,6 +124,8 @@ namespace iroha {
           const std::string &pg_reconnection_options,
           logger::LoggerManagerTreePtr log_manager);
 
+      static const std::string migrate_account_details_;
+
      public:
       static const std::string init_;
     };
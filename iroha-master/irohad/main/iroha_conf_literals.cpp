@@ -7,8 +7,14 @@
 
 namespace config_members {
   const char *BlockStorePath = "block_store_path";
+  const char *BlockStoreSyncInterval = "block_store_sync_interval";
+  const char *BlockStoreSegmentSize = "block_store_segment_size";
+  const char *BlockStoreHotBlocks = "block_store_hot_blocks";
+  const char *BlockStoreColdPath = "block_store_cold_path";
   const char *ToriiPort = "torii_port";
   const char *InternalPort = "internal_port";
+  const char *MetricsPort = "metrics_port";
+  const char *MetricsAddress = "metrics_address";
   const char *KeyPairPath = "key_pair_path";
   const char *PgOpt = "pg_opt";
   const char *DbConfig = "database";
@@ -21,10 +27,25 @@ namespace config_members {
   const char *MaxProposalSize = "max_proposal_size";
   const char *ProposalDelay = "proposal_delay";
   const char *VoteDelay = "vote_delay";
+  const char *VoteBroadcast = "vote_broadcast";
   const char *MstSupport = "mst_enable";
   const char *MstExpirationTime = "mst_expiration_time";
   const char *MaxRoundsDelay = "max_rounds_delay";
   const char *StaleStreamMaxRounds = "stale_stream_max_rounds";
+  const char *TransactionTtl = "transaction_ttl";
+  const char *AdmissionControlSection = "admission_control";
+  const char *MaxPendingBatches = "max_pending_batches";
+  const char *AccountTxRate = "account_tx_rate";
+  const char *ClientTxRate = "client_tx_rate";
+  const char *ProposalBudgetSection = "proposal_budget";
+  const char *MaxProposalBytes = "max_bytes";
+  const char *MaxProposalCommands = "max_commands";
+  const char *MaxProposalCost = "max_cost";
+  const char *CommandCosts = "command_costs";
+  const char *TracingSection = "tracing";
+  const char *TracingBufferSize = "buffer_size";
+  const char *TracingPath = "path";
+  const char *TracingDumpIntervalMs = "dump_interval_ms";
   const char *LogSection = "log";
   const char *LogLevel = "level";
   const char *LogPatternsSection = "patterns";
@@ -36,6 +57,18 @@ namespace config_members {
       {"warning", logger::LogLevel::kWarn},
       {"error", logger::LogLevel::kError},
       {"critical", logger::LogLevel::kCritical}};
+  const char *LogRateLimit = "rate_limit";
+  const char *LogFileSection = "file";
+  const char *LogFilePath = "path";
+  const char *LogFileMaxSize = "max_size";
+  const char *LogFileMaxFiles = "max_files";
+  const char *LogAsyncSection = "async";
+  const char *LogAsyncQueueSize = "queue_size";
+  const char *LogAsyncOverflow = "overflow";
+  const std::unordered_map<std::string, logger::LogOverflowPolicy>
+      LogOverflowPolicies{
+          {"block", logger::LogOverflowPolicy::kBlock},
+          {"drop_oldest", logger::LogOverflowPolicy::kDropOldest}};
   const char *Address = "address";
   const char *PublicKey = "public_key";
   const char *InitialPeers = "initial_peers";
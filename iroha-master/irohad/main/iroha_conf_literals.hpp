@@ -9,12 +9,18 @@
 #include <string>
 #include <unordered_map>
 
-#include "logger/logger.hpp"
+#include "logger/logger_spdlog.hpp"
 
 namespace config_members {
   extern const char *BlockStorePath;
+  extern const char *BlockStoreSyncInterval;
+  extern const char *BlockStoreSegmentSize;
+  extern const char *BlockStoreHotBlocks;
+  extern const char *BlockStoreColdPath;
   extern const char *ToriiPort;
   extern const char *InternalPort;
+  extern const char *MetricsPort;
+  extern const char *MetricsAddress;
   extern const char *KeyPairPath;
   extern const char *PgOpt;
   extern const char *DbConfig;
@@ -27,15 +33,40 @@ namespace config_members {
   extern const char *MaxProposalSize;
   extern const char *ProposalDelay;
   extern const char *VoteDelay;
+  extern const char *VoteBroadcast;
   extern const char *MstSupport;
   extern const char *MstExpirationTime;
   extern const char *MaxRoundsDelay;
   extern const char *StaleStreamMaxRounds;
+  extern const char *TransactionTtl;
+  extern const char *AdmissionControlSection;
+  extern const char *MaxPendingBatches;
+  extern const char *AccountTxRate;
+  extern const char *ClientTxRate;
+  extern const char *ProposalBudgetSection;
+  extern const char *MaxProposalBytes;
+  extern const char *MaxProposalCommands;
+  extern const char *MaxProposalCost;
+  extern const char *CommandCosts;
+  extern const char *TracingSection;
+  extern const char *TracingBufferSize;
+  extern const char *TracingPath;
+  extern const char *TracingDumpIntervalMs;
   extern const char *LogSection;
   extern const char *LogLevel;
   extern const char *LogPatternsSection;
   extern const char *LogChildrenSection;
   extern const std::unordered_map<std::string, logger::LogLevel> LogLevels;
+  extern const char *LogRateLimit;
+  extern const char *LogFileSection;
+  extern const char *LogFilePath;
+  extern const char *LogFileMaxSize;
+  extern const char *LogFileMaxFiles;
+  extern const char *LogAsyncSection;
+  extern const char *LogAsyncQueueSize;
+  extern const char *LogAsyncOverflow;
+  extern const std::unordered_map<std::string, logger::LogOverflowPolicy>
+      LogOverflowPolicies;
   extern const char *InitialPeers;
   extern const char *Address;
   extern const char *PublicKey;
@@ -90,6 +90,17 @@ class JsonDeserializerImpl {
     }
   }
 
+  template <typename Elem>
+  void getVal(const std::string &path,
+              std::map<std::string, Elem> &dest,
+              const rapidjson::Value &src) {
+    assert_fatal(src.IsObject(), path + " must be an object.");
+    for (const auto &entry : src.GetObject()) {
+      std::string key = entry.name.GetString();
+      getVal(sublevelPath(path, key), dest[key], entry.value);
+    }
+  }
+
   template <typename T>
   void getVal(const std::string &path,
               std::shared_ptr<T> &dest,
@@ -141,7 +152,9 @@ class JsonDeserializerImpl {
             getOptValByKey<logger::LogLevel>(
                 child_path, child_obj, config_members::LogLevel),
             getOptValByKey<logger::LogPatterns>(
-                child_path, child_obj, config_members::LogPatternsSection));
+                child_path, child_obj, config_members::LogPatternsSection),
+            getOptValByKey<uint32_t>(
+                child_path, child_obj, config_members::LogRateLimit));
         addChildrenLoggerConfigs(std::move(child_path), *child_conf, child_obj);
       }
     }
@@ -159,6 +172,61 @@ class JsonDeserializerImpl {
                           const rapidjson::Value::ConstObject &obj) {
     tryGetValByKey(path, cfg.log_level, obj, config_members::LogLevel);
     tryGetValByKey(path, cfg.patterns, obj, config_members::LogPatternsSection);
+    tryGetValByKey(path, cfg.rate_limit, obj, config_members::LogRateLimit);
+  }
+
+  /**
+   * Loads the output options of the logger tree from the root logger JSON
+   * object.
+   * @param path - current config node path used to denote the possible error
+   *    place.
+   * @param obj - the root logger JSON object
+   * @return the options, or nullptr if neither file nor asynchronous output
+   *    is configured
+   */
+  std::shared_ptr<const logger::LogSinkConfig> getLogSinkConfig(
+      const std::string &path, const rapidjson::Value::ConstObject &obj) {
+    const auto file_it = obj.FindMember(config_members::LogFileSection);
+    const auto async_it = obj.FindMember(config_members::LogAsyncSection);
+    if (file_it == obj.MemberEnd() and async_it == obj.MemberEnd()) {
+      return nullptr;
+    }
+    auto config = std::make_shared<logger::LogSinkConfig>();
+    if (file_it != obj.MemberEnd()) {
+      const auto file_path = sublevelPath(path, config_members::LogFileSection);
+      assert_fatal(file_it->value.IsObject(),
+                   file_path + " must be an object.");
+      const auto file_obj = file_it->value.GetObject();
+      config->file_path = std::string{};
+      getValByKey(
+          file_path, *config->file_path, file_obj, config_members::LogFilePath);
+      tryGetValByKey(file_path,
+                     config->file_max_size,
+                     file_obj,
+                     config_members::LogFileMaxSize);
+      tryGetValByKey(file_path,
+                     config->file_max_files,
+                     file_obj,
+                     config_members::LogFileMaxFiles);
+    }
+    if (async_it != obj.MemberEnd()) {
+      const auto async_path =
+          sublevelPath(path, config_members::LogAsyncSection);
+      assert_fatal(async_it->value.IsObject(),
+                   async_path + " must be an object.");
+      const auto async_obj = async_it->value.GetObject();
+      getValByKey(async_path,
+                  config->async_queue_size,
+                  async_obj,
+                  config_members::LogAsyncQueueSize);
+      assert_fatal(config->async_queue_size > 0,
+                   async_path + " queue size must be positive.");
+      tryGetValByKey(async_path,
+                     config->overflow_policy,
+                     async_obj,
+                     config_members::LogAsyncOverflow);
+    }
+    return config;
   }
 
   /**
@@ -292,6 +360,25 @@ inline void JsonDeserializerImpl::getVal<logger::LogLevel>(
   dest = it->second;
 }
 
+template <>
+inline void JsonDeserializerImpl::getVal<logger::LogOverflowPolicy>(
+    const std::string &path,
+    logger::LogOverflowPolicy &dest,
+    const rapidjson::Value &src) {
+  std::string policy_str;
+  getVal(path, policy_str, src);
+  const auto it = config_members::LogOverflowPolicies.find(policy_str);
+  if (it == config_members::LogOverflowPolicies.end()) {
+    BOOST_THROW_EXCEPTION(std::runtime_error(
+        "Wrong overflow policy at " + path + ": must be one of '"
+        + boost::algorithm::join(
+              config_members::LogOverflowPolicies | boost::adaptors::map_keys,
+              "', '")
+        + "'."));
+  }
+  dest = it->second;
+}
+
 template <>
 inline void JsonDeserializerImpl::getVal<logger::LogPatterns>(
     const std::string &path,
@@ -318,6 +405,7 @@ JsonDeserializerImpl::getVal<std::unique_ptr<logger::LoggerManagerTree>>(
   logger::LoggerConfig root_config{logger::kDefaultLogLevel,
                                    logger::LogPatterns{}};
   updateLoggerConfig(path, root_config, src.GetObject());
+  root_config.sinks = getLogSinkConfig(path, src.GetObject());
   dest = std::make_unique<logger::LoggerManagerTree>(
       std::make_shared<const logger::LoggerConfig>(std::move(root_config)));
   addChildrenLoggerConfigs(path, *dest, src.GetObject());
@@ -364,6 +452,50 @@ inline void JsonDeserializerImpl::getVal<IrohadConfig::DbConfig>(
       path, dest.maintenance_dbname, obj, config_members::MaintenanceDbName);
 }
 
+template <>
+inline void JsonDeserializerImpl::getVal<IrohadConfig::AdmissionControlConfig>(
+    const std::string &path,
+    IrohadConfig::AdmissionControlConfig &dest,
+    const rapidjson::Value &src) {
+  assert_fatal(
+      src.IsObject(),
+      path + " admission control config top element must be an object.");
+  const auto obj = src.GetObject();
+  getValByKey(
+      path, dest.max_pending_batches, obj, config_members::MaxPendingBatches);
+  getValByKey(path, dest.account_tx_rate, obj, config_members::AccountTxRate);
+  getValByKey(path, dest.client_tx_rate, obj, config_members::ClientTxRate);
+}
+
+template <>
+inline void JsonDeserializerImpl::getVal<IrohadConfig::ProposalBudgetConfig>(
+    const std::string &path,
+    IrohadConfig::ProposalBudgetConfig &dest,
+    const rapidjson::Value &src) {
+  assert_fatal(src.IsObject(),
+               path + " proposal budget config top element must be an object.");
+  const auto obj = src.GetObject();
+  getValByKey(path, dest.max_bytes, obj, config_members::MaxProposalBytes);
+  getValByKey(
+      path, dest.max_commands, obj, config_members::MaxProposalCommands);
+  getValByKey(path, dest.max_cost, obj, config_members::MaxProposalCost);
+  getValByKey(path, dest.command_costs, obj, config_members::CommandCosts);
+}
+
+template <>
+inline void JsonDeserializerImpl::getVal<IrohadConfig::TracingConfig>(
+    const std::string &path,
+    IrohadConfig::TracingConfig &dest,
+    const rapidjson::Value &src) {
+  assert_fatal(src.IsObject(),
+               path + " tracing config top element must be an object.");
+  const auto obj = src.GetObject();
+  getValByKey(path, dest.buffer_size, obj, config_members::TracingBufferSize);
+  getValByKey(path, dest.path, obj, config_members::TracingPath);
+  getValByKey(
+      path, dest.dump_interval_ms, obj, config_members::TracingDumpIntervalMs);
+}
+
 template <>
 inline void JsonDeserializerImpl::getVal<IrohadConfig>(
     const std::string &path, IrohadConfig &dest, const rapidjson::Value &src) {
@@ -371,14 +503,34 @@ inline void JsonDeserializerImpl::getVal<IrohadConfig>(
                path + " Irohad config top element must be an object.");
   const auto obj = src.GetObject();
   getValByKey(path, dest.block_store_path, obj, config_members::BlockStorePath);
+  getValByKey(path,
+              dest.block_store_sync_interval,
+              obj,
+              config_members::BlockStoreSyncInterval);
+  getValByKey(path,
+              dest.block_store_segment_size,
+              obj,
+              config_members::BlockStoreSegmentSize);
+  getValByKey(path,
+              dest.block_store_hot_blocks,
+              obj,
+              config_members::BlockStoreHotBlocks);
+  getValByKey(path,
+              dest.block_store_cold_path,
+              obj,
+              config_members::BlockStoreColdPath);
   getValByKey(path, dest.torii_port, obj, config_members::ToriiPort);
   getValByKey(path, dest.internal_port, obj, config_members::InternalPort);
+  getValByKey(path, dest.metrics_port, obj, config_members::MetricsPort);
+  getValByKey(
+      path, dest.metrics_address, obj, config_members::MetricsAddress);
   getValByKey(path, dest.pg_opt, obj, config_members::PgOpt);
   getValByKey(path, dest.database_config, obj, config_members::DbConfig);
   getValByKey(
       path, dest.max_proposal_size, obj, config_members::MaxProposalSize);
   getValByKey(path, dest.proposal_delay, obj, config_members::ProposalDelay);
   getValByKey(path, dest.vote_delay, obj, config_members::VoteDelay);
+  getValByKey(path, dest.vote_broadcast, obj, config_members::VoteBroadcast);
   getValByKey(path, dest.mst_support, obj, config_members::MstSupport);
   getValByKey(
       path, dest.mst_expiration_time, obj, config_members::MstExpirationTime);
@@ -388,6 +540,17 @@ inline void JsonDeserializerImpl::getVal<IrohadConfig>(
               dest.stale_stream_max_rounds,
               obj,
               config_members::StaleStreamMaxRounds);
+  getValByKey(
+      path, dest.transaction_ttl_ms, obj, config_members::TransactionTtl);
+  getValByKey(path,
+              dest.admission_control,
+              obj,
+              config_members::AdmissionControlSection);
+  getValByKey(path,
+              dest.proposal_budget,
+              obj,
+              config_members::ProposalBudgetSection);
+  getValByKey(path, dest.tracing, obj, config_members::TracingSection);
   getValByKey(path, dest.logger_manager, obj, config_members::LogSection);
   getValByKey(path, dest.initial_peers, obj, config_members::InitialPeers);
 }
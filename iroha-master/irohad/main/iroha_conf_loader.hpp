@@ -6,6 +6,7 @@
 #ifndef IROHA_CONF_LOADER_HPP
 #define IROHA_CONF_LOADER_HPP
 
+#include <map>
 #include <string>
 #include <unordered_map>
 
@@ -23,11 +24,36 @@ struct IrohadConfig {
     std::string maintenance_dbname;
   };
 
+  struct AdmissionControlConfig {
+    boost::optional<uint32_t> max_pending_batches;
+    boost::optional<uint32_t> account_tx_rate;
+    boost::optional<uint32_t> client_tx_rate;
+  };
+
+  struct ProposalBudgetConfig {
+    boost::optional<uint32_t> max_bytes;
+    boost::optional<uint32_t> max_commands;
+    boost::optional<uint32_t> max_cost;
+    boost::optional<std::map<std::string, uint32_t>> command_costs;
+  };
+
+  struct TracingConfig {
+    uint32_t buffer_size;
+    std::string path;
+    boost::optional<uint32_t> dump_interval_ms;
+  };
+
   // TODO: block_store_path is now optional, change docs IR-576
   // luckychess 29.06.2019
   boost::optional<std::string> block_store_path;
+  boost::optional<uint32_t> block_store_sync_interval;
+  boost::optional<uint32_t> block_store_segment_size;
+  boost::optional<uint32_t> block_store_hot_blocks;
+  boost::optional<std::string> block_store_cold_path;
   uint16_t torii_port;
   uint16_t internal_port;
+  boost::optional<uint16_t> metrics_port;
+  boost::optional<std::string> metrics_address;
   boost::optional<std::string>
       pg_opt;  // TODO 2019.06.26 mboldyrev IR-556 remove
   boost::optional<DbConfig>
@@ -35,10 +61,15 @@ struct IrohadConfig {
   uint32_t max_proposal_size;
   uint32_t proposal_delay;
   uint32_t vote_delay;
+  boost::optional<bool> vote_broadcast;
   bool mst_support;
   boost::optional<uint32_t> mst_expiration_time;
   boost::optional<uint32_t> max_round_delay_ms;
   boost::optional<uint32_t> stale_stream_max_rounds;
+  boost::optional<uint32_t> transaction_ttl_ms;
+  boost::optional<AdmissionControlConfig> admission_control;
+  boost::optional<ProposalBudgetConfig> proposal_budget;
+  boost::optional<TracingConfig> tracing;
   boost::optional<logger::LoggerManagerTreePtr> logger_manager;
   boost::optional<shared_model::interface::types::PeerList> initial_peers;
 };
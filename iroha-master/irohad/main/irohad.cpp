@@ -22,13 +22,19 @@
 #include "main/iroha_conf_literals.hpp"
 #include "main/iroha_conf_loader.hpp"
 #include "main/raw_block_loader.hpp"
+#include "metrics/metrics.hpp"
+#include "metrics/metrics_server.hpp"
+#include "tracing/trace_dumper.hpp"
 #include "validators/field_validator.hpp"
 
 static const std::string kListenIp = "0.0.0.0";
+static const std::string kMetricsIpDefault = "127.0.0.1";
 static const std::string kLogSettingsFromConfigFile = "config_file";
 static const uint32_t kMstExpirationTimeDefault = 1440;
 static const uint32_t kMaxRoundsDelayDefault = 3000;
 static const uint32_t kStaleStreamMaxRoundsDefault = 2;
+static const uint32_t kTransactionTtlDefault = 24 * 60 * 60 * 1000;
+static const uint32_t kTraceDumpIntervalDefault = 10000;
 static const std::string kDefaultWorkingDatabaseName{"iroha_default"};
 
 /**
@@ -83,6 +89,14 @@ DEFINE_validator(keypair_name, &validate_keypair_name);
  */
 DEFINE_bool(overwrite_ledger, false, "Overwrite ledger data if existing");
 
+/**
+ * Creating boolean flag for moving account details of the previous schema
+ */
+DEFINE_bool(migrate_account_details,
+            false,
+            "Move account details from the account.data column of the "
+            "previous database schema to the account_has_detail table");
+
 static bool validateVerbosity(const char *flagname, const std::string &val) {
   if (val == kLogSettingsFromConfigFile) {
     return true;
@@ -195,9 +209,62 @@ int main(int argc, char *argv[]) {
     return EXIT_FAILURE;
   }
 
+  if (FLAGS_migrate_account_details) {
+    auto migrated =
+        iroha::ametsuchi::PgConnectionInit::migrateAccountDetails(*pg_opt);
+    if (auto error = iroha::expected::resultToOptionalError(migrated)) {
+      log->critical("{}", *error);
+      return EXIT_FAILURE;
+    }
+    log->info(iroha::expected::resultToOptionalValue(migrated).value()
+                  ? "Account details are migrated"
+                  : "No account details to migrate");
+  }
+
+  iroha::ametsuchi::FlatFileOptions block_store_options;
+  block_store_options.sync_interval = config.block_store_sync_interval.value_or(
+      block_store_options.sync_interval);
+  block_store_options.segment_size = config.block_store_segment_size.value_or(
+      block_store_options.segment_size);
+  block_store_options.hot_files =
+      config.block_store_hot_blocks.value_or(block_store_options.hot_files);
+  block_store_options.cold_path = config.block_store_cold_path;
+
+  size_t max_pending_batches = 0;
+  iroha::torii::AdmissionLimits admission_limits;
+  if (config.admission_control) {
+    const auto &admission = *config.admission_control;
+    max_pending_batches = admission.max_pending_batches.value_or(0);
+    admission_limits.account_tx_rate = admission.account_tx_rate.value_or(0);
+    admission_limits.client_tx_rate = admission.client_tx_rate.value_or(0);
+  }
+
+  iroha::ordering::ProposalBudget proposal_budget;
+  if (config.proposal_budget) {
+    const auto &budget = *config.proposal_budget;
+    proposal_budget.max_bytes = budget.max_bytes.value_or(0);
+    proposal_budget.max_commands = budget.max_commands.value_or(0);
+    proposal_budget.max_cost = budget.max_cost.value_or(0);
+    if (budget.command_costs) {
+      proposal_budget.command_costs = *budget.command_costs;
+    }
+  }
+
+  std::unique_ptr<iroha::tracing::TraceDumper> trace_dumper;
+  if (config.tracing) {
+    iroha::tracing::defaultTracer().enable(config.tracing->buffer_size);
+    trace_dumper = std::make_unique<iroha::tracing::TraceDumper>(
+        iroha::tracing::defaultTracer(),
+        config.tracing->path,
+        std::chrono::milliseconds(config.tracing->dump_interval_ms.value_or(
+            kTraceDumpIntervalDefault)),
+        log_manager->getChild("TraceDumper")->getLogger());
+  }
+
   // Configuring iroha daemon
   Irohad irohad(
       config.block_store_path,
+      block_store_options,
       std::move(pg_opt),
       kListenIp,  // TODO(mboldyrev) 17/10/2018: add a parameter in
                   // config file and/or command-line arguments?
@@ -206,12 +273,20 @@ int main(int argc, char *argv[]) {
       config.max_proposal_size,
       std::chrono::milliseconds(config.proposal_delay),
       std::chrono::milliseconds(config.vote_delay),
+      config.vote_broadcast.value_or(false)
+          ? iroha::consensus::yac::VoteDissemination::kBroadcast
+          : iroha::consensus::yac::VoteDissemination::kLeader,
       std::chrono::minutes(
           config.mst_expiration_time.value_or(kMstExpirationTimeDefault)),
       *keypair,
       std::chrono::milliseconds(
           config.max_round_delay_ms.value_or(kMaxRoundsDelayDefault)),
       config.stale_stream_max_rounds.value_or(kStaleStreamMaxRoundsDefault),
+      max_pending_batches,
+      std::chrono::milliseconds(
+          config.transaction_ttl_ms.value_or(kTransactionTtlDefault)),
+      std::move(proposal_budget),
+      admission_limits,
       std::move(config.initial_peers),
       log_manager->getChild("Irohad"),
       boost::make_optional(config.mst_support,
@@ -340,12 +415,31 @@ int main(int argc, char *argv[]) {
     log->critical("Irohad startup failed: {}", error->error);
     return EXIT_FAILURE;
   }
+
+  std::unique_ptr<iroha::metrics::MetricsServer> metrics_server;
+  if (config.metrics_port) {
+    metrics_server = std::make_unique<iroha::metrics::MetricsServer>(
+        iroha::metrics::defaultRegistry(),
+        log_manager->getChild("MetricsServer")->getLogger());
+    auto metrics_result =
+        metrics_server->run(config.metrics_address.value_or(kMetricsIpDefault),
+                            *config.metrics_port);
+    if (auto error = boost::get<iroha::expected::Error<std::string>>(
+            &metrics_result)) {
+      log->critical("Metrics server startup failed: {}", error->error);
+      return EXIT_FAILURE;
+    }
+  }
+
   exit_requested.get_future().wait();
 
   // We do not care about shutting down grpc servers
   // They do all necessary work in their destructors
   log->info("shutting down...");
 
+  // writes the final trace
+  trace_dumper.reset();
+
   gflags::ShutDownCommandLineFlags();
 
   return 0;
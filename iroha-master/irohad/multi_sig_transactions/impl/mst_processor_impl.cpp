@@ -35,7 +35,7 @@ namespace iroha {
       -> decltype(propagateBatch(batch)) {
     auto state_update = storage_->updateOwnState(batch);
     completedBatchesNotify(*state_update.completed_state_);
-    updatedBatchesNotify(*state_update.updated_state_);
+    updatedBatchesNotify(state_update.updated_state_);
     expiredBatchesNotify(
         storage_->extractExpiredTransactions(time_provider_->getCurrentTime()));
   }
@@ -64,10 +64,12 @@ namespace iroha {
     }
   }
 
-  void FairMstProcessor::updatedBatchesNotify(ConstRefState state) const {
-    if (not state.isEmpty()) {
-      state_subject_.get_subscriber().on_next(
-          std::make_shared<MstState>(state));
+  void FairMstProcessor::updatedBatchesNotify(
+      std::shared_ptr<MstState> state) const {
+    // the state of the update is emitted as is instead of a copy, it is not
+    // used after the notification
+    if (not state->isEmpty()) {
+      state_subject_.get_subscriber().on_next(std::move(state));
     }
   }
 
@@ -95,9 +97,9 @@ namespace iroha {
     auto state_update = storage_->apply(from, new_state);
 
     // updated batches
-    updatedBatchesNotify(*state_update.updated_state_);
     log_->info("New batches size: {}",
                state_update.updated_state_->getBatches().size());
+    updatedBatchesNotify(state_update.updated_state_);
 
     // completed batches
     completedBatchesNotify(*state_update.completed_state_);
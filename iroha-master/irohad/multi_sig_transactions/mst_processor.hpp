@@ -38,7 +38,8 @@ namespace iroha {
     bool batchInStorage(const DataType &batch) const;
 
     /**
-     * Prove updating of state for handling status of signing
+     * Prove updating of state for handling status of signing. Emitted states
+     * contain only the batches which are new or received new signatures
      */
     rxcpp::observable<std::shared_ptr<MstState>> onStateUpdate() const;
 
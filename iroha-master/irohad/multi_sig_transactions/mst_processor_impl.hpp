@@ -78,9 +78,9 @@ namespace iroha {
     /**
      * Notify subscribers when some of the batches received new signatures, but
      * still are not completed
-     * @param state with those batches
+     * @param state with only those batches, shared with the subscribers
      */
-    void updatedBatchesNotify(ConstRefState state) const;
+    void updatedBatchesNotify(std::shared_ptr<MstState> state) const;
 
     /**
      * Notify subscribers when some of the batches get expired
@@ -103,6 +103,10 @@ namespace iroha {
     return batches_.empty();
   }
 
+  size_t MstState::batchesQuantity() const {
+    return batches_.size();
+  }
+
   std::unordered_set<DataType,
                      iroha::model::PointerBatchHasher,
                      BatchHashEquality>
@@ -162,7 +166,8 @@ namespace iroha {
 
   void MstState::insertOne(StateUpdateResult &state_update,
                            const DataType &rhs_batch) {
-    log_->info("batch: {}", *rhs_batch);
+    // states received by gossip contain many known batches
+    log_->debug("batch: {}", *rhs_batch);
     auto corresponding = batches_.right.find(rhs_batch);
     if (corresponding == batches_.right.end()) {
       // when state does not contain transaction
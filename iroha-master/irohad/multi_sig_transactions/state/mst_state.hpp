@@ -128,6 +128,11 @@ namespace iroha {
      */
     bool isEmpty() const;
 
+    /**
+     * @return number of batches inside
+     */
+    size_t batchesQuantity() const;
+
     /**
      * @return the batches from the state
      */
@@ -19,6 +19,10 @@ namespace iroha {
     }
     return target_state_iter;
   }
+
+  void MstStorageStateImpl::updateStateSizeMetric() {
+    state_size_gauge_.set(own_state_.batchesQuantity());
+  }
   // -----------------------------| interface API |-----------------------------
 
   MstStorageStateImpl::MstStorageStateImpl(const CompleterType &completer,
@@ -27,7 +31,10 @@ namespace iroha {
       : MstStorage(log),
         completer_(completer),
         own_state_(MstState::empty(mst_state_logger, completer_)),
-        mst_state_logger_(std::move(mst_state_logger)) {}
+        mst_state_logger_(std::move(mst_state_logger)),
+        state_size_gauge_(metrics::defaultRegistry().gauge(
+            "iroha_mst_state_batches",
+            "Number of batches waiting for signatures")) {}
 
   auto MstStorageStateImpl::applyImpl(
       const shared_model::crypto::PublicKey &target_peer_key,
@@ -35,12 +42,16 @@ namespace iroha {
       -> decltype(apply(target_peer_key, new_state)) {
     auto target_state_iter = getState(target_peer_key);
     target_state_iter->second += new_state;
-    return own_state_ += new_state;
+    auto state_update = own_state_ += new_state;
+    updateStateSizeMetric();
+    return state_update;
   }
 
   auto MstStorageStateImpl::updateOwnStateImpl(const DataType &tx)
       -> decltype(updateOwnState(tx)) {
-    return own_state_ += tx;
+    auto state_update = own_state_ += tx;
+    updateStateSizeMetric();
+    return state_update;
   }
 
   auto MstStorageStateImpl::extractExpiredTransactionsImpl(
@@ -49,7 +60,9 @@ namespace iroha {
     for (auto &peer_and_state : peer_states_) {
       peer_and_state.second.eraseExpired(current_time);
     }
-    return own_state_.extractExpired(current_time);
+    auto expired = own_state_.extractExpired(current_time);
+    updateStateSizeMetric();
+    return expired;
   }
 
   auto MstStorageStateImpl::getDiffStateImpl(
@@ -8,6 +8,7 @@
 
 #include <unordered_map>
 #include "logger/logger_fwd.hpp"
+#include "metrics/metrics.hpp"
 #include "multi_sig_transactions/hash.hpp"
 #include "multi_sig_transactions/storage/mst_storage.hpp"
 
@@ -24,6 +25,9 @@ namespace iroha {
      */
     auto getState(const shared_model::crypto::PublicKey &target_peer_key);
 
+    /// Update the metric of own state size
+    void updateStateSizeMetric();
+
    public:
     // ----------------------------| interface API |----------------------------
     MstStorageStateImpl(const CompleterType &completer,
@@ -62,6 +66,8 @@ namespace iroha {
 
     logger::LoggerPtr mst_state_logger_;  ///< Logger for created MstState
                                           ///< objects.
+
+    metrics::Gauge &state_size_gauge_;  ///< Number of batches in own state
   };
 }  // namespace iroha
 
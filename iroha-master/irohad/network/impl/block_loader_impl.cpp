@@ -49,7 +49,6 @@ rxcpp::observable<std::shared_ptr<Block>> BlockLoaderImpl::retrieveBlocks(
 
         proto::BlockRequest request;
         grpc::ClientContext context;
-        protocol::Block block;
 
         // set a timeout to avoid being hung
         context.set_deadline(std::chrono::system_clock::now()
@@ -60,8 +59,16 @@ rxcpp::observable<std::shared_ptr<Block>> BlockLoaderImpl::retrieveBlocks(
 
         auto reader =
             this->getPeerStub(**peer).retrieveBlocks(&context, request);
-        while (subscriber.is_subscribed() and reader->Read(&block)) {
-          block_factory_.createBlock(std::move(block))
+        while (subscriber.is_subscribed()) {
+          // each block gets its own arena which lives as long as the block
+          auto arena = std::make_shared<google::protobuf::Arena>();
+          auto *block =
+              google::protobuf::Arena::CreateMessage<protocol::Block>(
+                  arena.get());
+          if (not reader->Read(block)) {
+            break;
+          }
+          block_factory_.createBlock(std::move(arena), *block)
               .match(
                   [&subscriber](auto &&result) {
                     subscriber.on_next(std::move(result.value));
@@ -86,18 +93,20 @@ boost::optional<std::shared_ptr<Block>> BlockLoaderImpl::retrieveBlock(
 
   proto::BlockRequest request;
   grpc::ClientContext context;
-  protocol::Block block;
+  auto arena = std::make_shared<google::protobuf::Arena>();
+  auto *block =
+      google::protobuf::Arena::CreateMessage<protocol::Block>(arena.get());
 
   // request block with specified height
   request.set_height(block_height);
 
-  auto status = getPeerStub(**peer).retrieveBlock(&context, request, &block);
+  auto status = getPeerStub(**peer).retrieveBlock(&context, request, block);
   if (not status.ok()) {
     log_->warn("{}", status.error_message());
     return boost::none;
   }
 
-  return block_factory_.createBlock(std::move(block))
+  return block_factory_.createBlock(std::move(arena), *block)
       .match(
           [](auto &&v) {
             return boost::make_optional(
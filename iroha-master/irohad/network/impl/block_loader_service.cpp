@@ -52,24 +52,19 @@ grpc::Status BlockLoaderService::retrieveBlocks(
   }
 
   auto top_height = (*block_query)->getTopBlockHeight();
-  for (decltype(top_height) i = request->height(); i <= top_height; ++i) {
-    auto block_result = (*block_query)->getBlock(i);
-
-    if (auto e = expected::resultToOptionalError(block_result)) {
-      return handleGetBlockError(e.value(), log_);
-    }
-
-    auto &block =
-        boost::get<
-            expected::Value<std::unique_ptr<shared_model::interface::Block>>>(
-            block_result)
-            .value;
-
-    protocol::Block proto_block;
-    *proto_block.mutable_block_v1() =
-        static_cast<shared_model::proto::Block *>(block.get())->getTransport();
-
-    writer->Write(proto_block);
+  auto result = (*block_query)->forEachBlock(
+      request->height(), top_height, [writer](auto block) {
+        protocol::Block proto_block;
+        *proto_block.mutable_block_v1() =
+            static_cast<const shared_model::proto::Block *>(block.get())
+                ->getTransport();
+
+        // stop reading blocks if the stream is closed
+        return writer->Write(proto_block);
+      });
+
+  if (auto e = expected::resultToOptionalError(result)) {
+    return handleGetBlockError(e.value(), log_);
   }
 
   return grpc::Status::OK;
@@ -36,6 +36,12 @@ namespace iroha {
       return ordering_gate_->onProposal();
     }
 
+    rxcpp::observable<
+        std::shared_ptr<shared_model::interface::TransactionBatch>>
+    PeerCommunicationServiceImpl::onExpiredBatches() const {
+      return ordering_gate_->onExpiredBatches();
+    }
+
     rxcpp::observable<simulator::VerifiedProposalCreatorEvent>
     PeerCommunicationServiceImpl::onVerifiedProposal() const {
       return proposal_creator_->onVerifiedProposal();
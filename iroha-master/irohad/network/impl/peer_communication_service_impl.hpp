@@ -36,6 +36,10 @@ namespace iroha {
 
       rxcpp::observable<OrderingEvent> onProposal() const override;
 
+      rxcpp::observable<
+          std::shared_ptr<shared_model::interface::TransactionBatch>>
+      onExpiredBatches() const override;
+
       rxcpp::observable<simulator::VerifiedProposalCreatorEvent>
       onVerifiedProposal() const override;
 
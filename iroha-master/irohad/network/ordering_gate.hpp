@@ -40,6 +40,15 @@ namespace iroha {
        */
       virtual rxcpp::observable<OrderingEvent> onProposal() = 0;
 
+      /**
+       * Return observable of batches which expired before being included in
+       * a block and were dropped
+       * @return observable with the expired batches
+       */
+      virtual rxcpp::observable<
+          std::shared_ptr<shared_model::interface::TransactionBatch>>
+      onExpiredBatches() = 0;
+
       virtual ~OrderingGate() = default;
     };
   }  // namespace network
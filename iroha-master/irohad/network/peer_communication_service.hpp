@@ -41,6 +41,15 @@ namespace iroha {
        */
       virtual rxcpp::observable<OrderingEvent> onProposal() const = 0;
 
+      /**
+       * Event is triggered when a batch expires before being included in a
+       * block and is dropped from ordering
+       * @return observable with the expired batches
+       */
+      virtual rxcpp::observable<
+          std::shared_ptr<shared_model::interface::TransactionBatch>>
+      onExpiredBatches() const = 0;
+
       /**
        * Event is triggered when verified proposal arrives
        * @return verified proposal and list of stateful validation errors
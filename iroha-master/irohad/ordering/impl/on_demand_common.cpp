@@ -5,6 +5,11 @@
 
 #include "ordering/impl/on_demand_common.hpp"
 
+#include <algorithm>
+
+#include "interfaces/iroha_internal/transaction_batch.hpp"
+#include "interfaces/transaction.hpp"
+
 namespace iroha {
   namespace ordering {
 
@@ -29,5 +34,18 @@ namespace iroha {
       return {round.block_round, round.reject_round + 1};
     }
 
+    bool isExpired(const shared_model::interface::TransactionBatch &batch,
+                   std::chrono::milliseconds ttl,
+                   shared_model::interface::types::TimestampType now) {
+      if (ttl.count() == 0) {
+        return false;
+      }
+      const auto &transactions = batch.transactions();
+      return std::any_of(
+          transactions.begin(), transactions.end(), [&](const auto &tx) {
+            return tx->createdTime() + ttl.count() < now;
+          });
+    }
+
   }  // namespace ordering
 }  // namespace iroha
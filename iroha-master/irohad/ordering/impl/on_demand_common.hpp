@@ -6,7 +6,16 @@
 #ifndef IROHA_ON_DEMAND_COMMON_HPP
 #define IROHA_ON_DEMAND_COMMON_HPP
 
+#include <chrono>
+
 #include "consensus/round.hpp"
+#include "interfaces/common_objects/types.hpp"
+
+namespace shared_model {
+  namespace interface {
+    class TransactionBatch;
+  }  // namespace interface
+}  // namespace shared_model
 
 namespace iroha {
   namespace ordering {
@@ -24,6 +33,18 @@ namespace iroha {
 
     consensus::Round nextRejectRound(const consensus::Round &round);
 
+    /**
+     * Check if the batch contains a transaction which was created more than
+     * ttl ago. Such batch can not be committed as a whole anymore
+     * @param batch - the batch to check
+     * @param ttl - time to live of transactions, zero means no expiration
+     * @param now - current time in milliseconds since epoch
+     * @return true if the batch is expired
+     */
+    bool isExpired(const shared_model::interface::TransactionBatch &batch,
+                   std::chrono::milliseconds ttl,
+                   shared_model::interface::types::TimestampType now);
+
   }  // namespace ordering
 }  // namespace iroha
 
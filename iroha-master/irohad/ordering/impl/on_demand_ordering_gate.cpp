@@ -9,14 +9,17 @@
 
 #include <boost/range/adaptor/filtered.hpp>
 #include <boost/range/adaptor/indexed.hpp>
+#include <boost/range/adaptor/indirected.hpp>
 #include <boost/range/adaptor/transformed.hpp>
 #include <boost/range/empty.hpp>
 #include "ametsuchi/tx_presence_cache.hpp"
 #include "common/visitor.hpp"
+#include "datetime/time.hpp"
 #include "interfaces/iroha_internal/transaction_batch.hpp"
 #include "interfaces/iroha_internal/transaction_batch_parser_impl.hpp"
 #include "logger/logger.hpp"
 #include "ordering/impl/on_demand_common.hpp"
+#include "tracing/tracer.hpp"
 
 using namespace iroha;
 using namespace iroha::ordering;
@@ -32,9 +35,11 @@ OnDemandOrderingGate::OnDemandOrderingGate(
     std::shared_ptr<shared_model::interface::UnsafeProposalFactory> factory,
     std::shared_ptr<ametsuchi::TxPresenceCache> tx_cache,
     size_t transaction_limit,
+    std::chrono::milliseconds tx_ttl,
     logger::LoggerPtr log)
     : log_(std::move(log)),
       transaction_limit_(transaction_limit),
+      tx_ttl_(tx_ttl),
       ordering_service_(std::move(ordering_service)),
       network_client_(std::move(network_client)),
       processed_tx_hashes_subscription_(
@@ -47,6 +52,7 @@ OnDemandOrderingGate::OnDemandOrderingGate(
       round_switch_subscription_(
           round_switch_events.subscribe([this](auto event) {
             log_->debug("Current: {}", event.next_round);
+            tracing::traceObject("round_started", event.next_round);
 
             // notify our ordering service about new round
             ordering_service_->onCollaborationOutcome(event.next_round);
@@ -56,6 +62,11 @@ OnDemandOrderingGate::OnDemandOrderingGate(
             // request proposal for the current round
             auto proposal = this->processProposalRequest(
                 network_client_->onRequestProposal(event.next_round));
+            if (proposal and tracing::defaultTracer().enabled()) {
+              tracing::traceTransactions("proposal_received",
+                                         (*proposal)->transactions(),
+                                         event.next_round.toString());
+            }
             // vote for the object received from the network
             proposal_notifier_.get_subscriber().on_next(
                 network::OrderingEvent{std::move(proposal),
@@ -65,16 +76,23 @@ OnDemandOrderingGate::OnDemandOrderingGate(
       cache_(std::move(cache)),
       proposal_factory_(std::move(factory)),
       tx_cache_(std::move(tx_cache)),
-      proposal_notifier_(proposal_notifier_lifetime_) {}
+      proposal_notifier_(proposal_notifier_lifetime_),
+      expired_batches_notifier_(expired_batches_notifier_lifetime_) {}
 
 OnDemandOrderingGate::~OnDemandOrderingGate() {
   proposal_notifier_lifetime_.unsubscribe();
+  expired_batches_notifier_lifetime_.unsubscribe();
   processed_tx_hashes_subscription_.unsubscribe();
   round_switch_subscription_.unsubscribe();
 }
 
 void OnDemandOrderingGate::propagateBatch(
     std::shared_ptr<shared_model::interface::TransactionBatch> batch) {
+  if (dropIfExpired(batch, iroha::time::now())) {
+    return;
+  }
+  tracing::traceTransactions(
+      "sent_to_ordering", batch->transactions() | boost::adaptors::indirected);
   cache_->addToBack({batch});
 
   network_client_->onBatches(
@@ -85,6 +103,11 @@ rxcpp::observable<network::OrderingEvent> OnDemandOrderingGate::onProposal() {
   return proposal_notifier_.get_observable();
 }
 
+rxcpp::observable<std::shared_ptr<shared_model::interface::TransactionBatch>>
+OnDemandOrderingGate::onExpiredBatches() {
+  return expired_batches_notifier_.get_observable();
+}
+
 boost::optional<std::shared_ptr<const shared_model::interface::Proposal>>
 OnDemandOrderingGate::processProposalRequest(
     boost::optional<
@@ -105,6 +128,14 @@ void OnDemandOrderingGate::sendCachedTransactions() {
   // TODO mboldyrev 22.03.2019 IR-425
   // make cache_->getBatchesForRound(current_round) that respects sync
   auto batches = cache_->pop();
+  auto now = iroha::time::now();
+  for (auto it = batches.begin(); it != batches.end();) {
+    if (dropIfExpired(*it, now)) {
+      it = batches.erase(it);
+    } else {
+      ++it;
+    }
+  }
   cache_->addToBack(batches);
 
   // get only transactions which fit to next proposal
@@ -125,6 +156,17 @@ void OnDemandOrderingGate::sendCachedTransactions() {
   }
 }
 
+bool OnDemandOrderingGate::dropIfExpired(
+    const std::shared_ptr<shared_model::interface::TransactionBatch> &batch,
+    shared_model::interface::types::TimestampType now) {
+  if (not isExpired(*batch, tx_ttl_, now)) {
+    return false;
+  }
+  log_->info("Dropping expired batch {}", batch->reducedHash().hex());
+  expired_batches_notifier_.get_subscriber().on_next(batch);
+  return true;
+}
+
 std::shared_ptr<const shared_model::interface::Proposal>
 OnDemandOrderingGate::removeReplays(
     std::shared_ptr<const shared_model::interface::Proposal> proposal) const {
@@ -8,6 +8,7 @@
 
 #include "network/ordering_gate.hpp"
 
+#include <chrono>
 #include <shared_mutex>
 
 #include <boost/variant.hpp>
@@ -56,6 +57,7 @@ namespace iroha {
               factory,
           std::shared_ptr<ametsuchi::TxPresenceCache> tx_cache,
           size_t transaction_limit,
+          std::chrono::milliseconds tx_ttl,
           logger::LoggerPtr log);
 
       ~OnDemandOrderingGate() override;
@@ -66,6 +68,10 @@ namespace iroha {
 
       rxcpp::observable<network::OrderingEvent> onProposal() override;
 
+      rxcpp::observable<
+          std::shared_ptr<shared_model::interface::TransactionBatch>>
+      onExpiredBatches() override;
+
      private:
       /**
        * Handle an incoming proposal from ordering service
@@ -78,6 +84,15 @@ namespace iroha {
 
       void sendCachedTransactions();
 
+      /**
+       * Notify about the batch if it has expired transactions
+       * @return true if the batch is expired
+       */
+      bool dropIfExpired(
+          const std::shared_ptr<shared_model::interface::TransactionBatch>
+              &batch,
+          shared_model::interface::types::TimestampType now);
+
       /**
        * remove already processed transactions from proposal
        */
@@ -89,6 +104,8 @@ namespace iroha {
 
       /// max number of transactions passed to one ordering service
       size_t transaction_limit_;
+      /// time since creation after which transactions are dropped
+      std::chrono::milliseconds tx_ttl_;
       std::shared_ptr<OnDemandOrderingService> ordering_service_;
       std::shared_ptr<transport::OdOsNotification> network_client_;
       rxcpp::composite_subscription processed_tx_hashes_subscription_;
@@ -100,6 +117,11 @@ namespace iroha {
 
       rxcpp::composite_subscription proposal_notifier_lifetime_;
       rxcpp::subjects::subject<network::OrderingEvent> proposal_notifier_;
+
+      rxcpp::composite_subscription expired_batches_notifier_lifetime_;
+      rxcpp::subjects::subject<
+          std::shared_ptr<shared_model::interface::TransactionBatch>>
+          expired_batches_notifier_;
     };
 
   }  // namespace ordering
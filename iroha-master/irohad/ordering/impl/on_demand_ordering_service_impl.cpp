@@ -28,17 +28,38 @@ using TransactionBatchType = transport::OdOsNotification::TransactionBatchType;
 
 OnDemandOrderingServiceImpl::OnDemandOrderingServiceImpl(
     size_t transaction_limit,
+    size_t max_pending_batches,
+    std::chrono::milliseconds tx_ttl,
+    ProposalBudget proposal_budget,
     std::shared_ptr<shared_model::interface::UnsafeProposalFactory>
         proposal_factory,
     std::shared_ptr<ametsuchi::TxPresenceCache> tx_cache,
     logger::LoggerPtr log,
     size_t number_of_proposals,
     const consensus::Round &initial_round)
-    : transaction_limit_(transaction_limit),
+    : max_pending_batches_(max_pending_batches),
+      tx_ttl_(tx_ttl),
       number_of_proposals_(number_of_proposals),
       proposal_factory_(std::move(proposal_factory)),
       tx_cache_(std::move(tx_cache)),
-      log_(std::move(log)) {
+      log_(std::move(log)),
+      packing_policy_(transaction_limit, std::move(proposal_budget), log_),
+      pending_batches_gauge_(metrics::defaultRegistry().gauge(
+          "iroha_ordering_pending_batches",
+          "Number of batches waiting for the next proposal")),
+      proposal_size_histogram_(metrics::defaultRegistry().histogram(
+          "iroha_ordering_proposal_transactions",
+          "Number of transactions in the packed proposals",
+          metrics::exponentialBounds(1, 2, 16))),
+      discarded_txs_counter_(metrics::defaultRegistry().counter(
+          "iroha_ordering_discarded_transactions_total",
+          "Number of transactions which did not fit into the proposals")),
+      dropped_batches_counter_(metrics::defaultRegistry().counter(
+          "iroha_ordering_dropped_batches_total",
+          "Number of batches dropped since the pending queue was full")),
+      expired_batches_counter_(metrics::defaultRegistry().counter(
+          "iroha_ordering_expired_batches_total",
+          "Number of batches evicted due to expired transactions")) {
   onCollaborationOutcome(initial_round);
 }
 
@@ -55,19 +76,40 @@ void OnDemandOrderingServiceImpl::onCollaborationOutcome(
 // ----------------------------| OdOsNotification |-----------------------------
 
 void OnDemandOrderingServiceImpl::onBatches(CollectionType batches) {
+  auto now = iroha::time::now();
   auto unprocessed_batches =
-      boost::adaptors::filter(batches, [this](const auto &batch) {
+      boost::adaptors::filter(batches, [this, now](const auto &batch) {
+        if (isExpired(*batch, tx_ttl_, now)) {
+          log_->debug("batch {} is expired", batch->reducedHash().hex());
+          return false;
+        }
         log_->debug("check batch {} for already processed transactions",
                     batch->reducedHash().hex());
         return not this->batchAlreadyProcessed(*batch);
       });
+  size_t dropped_batches = 0;
   std::for_each(
       unprocessed_batches.begin(),
       unprocessed_batches.end(),
-      [this](auto &obj) {
+      [this, &dropped_batches](auto &obj) {
         std::shared_lock<std::shared_timed_mutex> lock(batches_mutex_);
+        // concurrent insertions may exceed the limit by the number of
+        // inserting threads, which is acceptable for memory bounding
+        if (max_pending_batches_ != 0
+            and pending_batches_.size() >= max_pending_batches_) {
+          ++dropped_batches;
+          return;
+        }
         pending_batches_.insert(std::move(obj));
       });
+  pending_batches_gauge_.set(pending_batches_.size());
+  if (dropped_batches != 0) {
+    // the batches stay in the caches of the ordering gates, which resend them
+    // in the next rounds
+    log_->warn("onBatches => pending queue is full, dropped {} batches",
+               dropped_batches);
+    dropped_batches_counter_.increment(dropped_batches);
+  }
   log_->info("onBatches => collection size = {}", batches.size());
 }
 
@@ -96,34 +138,64 @@ OnDemandOrderingServiceImpl::onRequestProposal(consensus::Round round) {
 
 /**
  * Get transactions from the given batches queue. Does not break batches -
- * continues getting all the transactions from the ongoing batch until the
- * required amount is collected.
- * @param requested_tx_amount - amount of transactions to get
+ * a batch which does not fit into the proposal is skipped, and the following
+ * smaller batches may still fill the remaining capacity. The batches skipped
+ * in the previous round are packed first, so that a batch exceeding the budget
+ * on its own gets an empty proposal instead of being starved by the others.
+ * @param packing_policy - the policy which decides if a batch fits
  * @param batch_collection - the collection to get transactions from
+ * @param skipped_batches - the batches skipped in the previous round, replaced
+ * with the batches skipped in this one
  * @param discarded_txs_amount - the amount of discarded txs
  * @return transactions
  */
 static std::vector<std::shared_ptr<shared_model::interface::Transaction>>
-getTransactions(size_t requested_tx_amount,
+getTransactions(const ProposalPackingPolicy &packing_policy,
                 detail::BatchSetType &batch_collection,
+                std::vector<TransactionBatchType> &skipped_batches,
                 boost::optional<size_t &> discarded_txs_amount) {
   std::vector<std::shared_ptr<shared_model::interface::Transaction>> collection;
+  ProposalPackingPolicy::Usage packed;
+  size_t discarded = 0;
+  std::vector<TransactionBatchType> skipped;
+  std::unordered_set<TransactionBatchType,
+                     model::PointerBatchHasher,
+                     BatchHashEquality>
+      prioritized;
 
-  auto it = batch_collection.begin();
-  for (; it != batch_collection.end()
-       and collection.size() + boost::size((*it)->transactions())
-           <= requested_tx_amount;
-       ++it) {
+  auto pack = [&](const TransactionBatchType &batch) {
+    if (packing_policy.full(packed)) {
+      discarded += boost::size(batch->transactions());
+      return;
+    }
+    auto usage = packing_policy.usage(*batch);
+    if (not packing_policy.fits(packed, usage)) {
+      discarded += usage.transactions;
+      skipped.push_back(batch);
+      return;
+    }
+    packed += usage;
     collection.insert(std::end(collection),
-                      std::begin((*it)->transactions()),
-                      std::end((*it)->transactions()));
+                      std::begin(batch->transactions()),
+                      std::end(batch->transactions()));
+  };
+
+  for (const auto &batch : skipped_batches) {
+    // the batch may have been committed or evicted since it was skipped
+    auto it = batch_collection.find(batch);
+    if (it != batch_collection.end() and prioritized.insert(*it).second) {
+      pack(*it);
+    }
+  }
+  for (const auto &batch : batch_collection) {
+    if (prioritized.find(batch) == prioritized.end()) {
+      pack(batch);
+    }
   }
+  skipped_batches = std::move(skipped);
 
   if (discarded_txs_amount) {
-    *discarded_txs_amount = 0;
-    for (; it != batch_collection.end(); ++it) {
-      *discarded_txs_amount += boost::size((*it)->transactions());
-    }
+    *discarded_txs_amount = discarded;
   }
 
   return collection;
@@ -179,9 +251,15 @@ void OnDemandOrderingServiceImpl::packNextProposals(
         discarded_txs_quantity);
   };
 
+  evictExpired(now);
+
   if (not pending_batches_.empty()) {
-    auto txs = getTransactions(
-        transaction_limit_, pending_batches_, discarded_txs_quantity);
+    auto txs = getTransactions(packing_policy_,
+                               pending_batches_,
+                               skipped_batches_,
+                               discarded_txs_quantity);
+    proposal_size_histogram_.observe(txs.size());
+    discarded_txs_counter_.increment(discarded_txs_quantity);
     if (not txs.empty()) {
       generate_proposal({round.block_round, round.reject_round + 1}, txs);
       generate_proposal({round.block_round + 1, kFirstRejectRound}, txs);
@@ -191,6 +269,7 @@ void OnDemandOrderingServiceImpl::packNextProposals(
   if (round.reject_round == kFirstRejectRound) {
     std::lock_guard<std::shared_timed_mutex> lock(batches_mutex_);
     pending_batches_.clear();
+    pending_batches_gauge_.set(0);
   }
 }
 
@@ -223,6 +302,30 @@ void OnDemandOrderingServiceImpl::tryErase(
   }
 }
 
+void OnDemandOrderingServiceImpl::evictExpired(
+    shared_model::interface::types::TimestampType now) {
+  if (tx_ttl_.count() == 0) {
+    return;
+  }
+  size_t expired_batches = 0;
+  {
+    std::lock_guard<std::shared_timed_mutex> lock(batches_mutex_);
+    for (auto it = pending_batches_.begin(); it != pending_batches_.end();) {
+      if (isExpired(**it, tx_ttl_, now)) {
+        it = pending_batches_.unsafe_erase(it);
+        ++expired_batches;
+      } else {
+        ++it;
+      }
+    }
+    pending_batches_gauge_.set(pending_batches_.size());
+  }
+  if (expired_batches != 0) {
+    log_->info("evictExpired => evicted {} batches", expired_batches);
+    expired_batches_counter_.increment(expired_batches);
+  }
+}
+
 bool OnDemandOrderingServiceImpl::batchAlreadyProcessed(
     const shared_model::interface::TransactionBatch &batch) {
   auto tx_statuses = tx_cache_->check(batch);
@@ -10,14 +10,17 @@
 
 #include <map>
 #include <shared_mutex>
+#include <vector>
 
 #include <tbb/concurrent_unordered_set.h>
 #include "interfaces/iroha_internal/unsafe_proposal_factory.hpp"
 #include "logger/logger_fwd.hpp"
+#include "metrics/metrics.hpp"
 #include "multi_sig_transactions/hash.hpp"
 // TODO 2019-03-15 andrei: IR-403 Separate BatchHashEquality and MstState
 #include "multi_sig_transactions/state/mst_state.hpp"
 #include "ordering/impl/on_demand_common.hpp"
+#include "ordering/impl/proposal_packing_policy.hpp"
 
 namespace iroha {
   namespace ametsuchi {
@@ -41,6 +44,12 @@ namespace iroha {
        * Create on_demand ordering service with following options:
        * @param transaction_limit - number of maximum transactions in one
        * proposal
+       * @param max_pending_batches - number of maximum batches waiting for a
+       * proposal, further batches are dropped. 0 means no limit
+       * @param tx_ttl - time since creation after which transactions are
+       * evicted. 0 means no expiration
+       * @param proposal_budget - limits of proposal size in bytes, commands
+       * and estimated execution cost
        * @param proposal_factory - used to generate proposals
        * @param tx_cache - cache of transactions
        * @param log to print progress
@@ -51,6 +60,9 @@ namespace iroha {
        */
       OnDemandOrderingServiceImpl(
           size_t transaction_limit,
+          size_t max_pending_batches,
+          std::chrono::milliseconds tx_ttl,
+          ProposalBudget proposal_budget,
           std::shared_ptr<shared_model::interface::UnsafeProposalFactory>
               proposal_factory,
           std::shared_ptr<ametsuchi::TxPresenceCache> tx_cache,
@@ -83,6 +95,12 @@ namespace iroha {
        */
       void tryErase(const consensus::Round &current_round);
 
+      /**
+       * Removes the pending batches with expired transactions
+       * @param now - current time in milliseconds since epoch
+       */
+      void evictExpired(shared_model::interface::types::TimestampType now);
+
       /**
        * Check if batch was already processed by the peer
        */
@@ -90,9 +108,14 @@ namespace iroha {
           const shared_model::interface::TransactionBatch &batch);
 
       /**
-       * Max number of transaction in one proposal
+       * Max number of batches waiting for a proposal, 0 means no limit
        */
-      size_t transaction_limit_;
+      size_t max_pending_batches_;
+
+      /**
+       * Time since creation after which transactions are evicted
+       */
+      std::chrono::milliseconds tx_ttl_;
 
       /**
        * Max number of available proposals in one OS
@@ -109,6 +132,13 @@ namespace iroha {
        */
       detail::BatchSetType pending_batches_;
 
+      /**
+       * Batches which did not fit into the last packed proposal, they are
+       * packed first in the next round
+       */
+      std::vector<transport::OdOsNotification::TransactionBatchType>
+          skipped_batches_;
+
       /**
        * Batches and proposal collection mutexes for public methods
        */
@@ -126,6 +156,36 @@ namespace iroha {
        * Logger instance
        */
       logger::LoggerPtr log_;
+
+      /**
+       * Selects the batches which fit into a proposal
+       */
+      ProposalPackingPolicy packing_policy_;
+
+      /**
+       * Number of batches waiting for the next proposal
+       */
+      metrics::Gauge &pending_batches_gauge_;
+
+      /**
+       * Number of transactions in the packed proposals
+       */
+      metrics::Histogram &proposal_size_histogram_;
+
+      /**
+       * Number of transactions which did not fit into the proposals
+       */
+      metrics::Counter &discarded_txs_counter_;
+
+      /**
+       * Number of batches dropped since the pending queue was full
+       */
+      metrics::Counter &dropped_batches_counter_;
+
+      /**
+       * Number of batches evicted due to expired transactions
+       */
+      metrics::Counter &expired_batches_counter_;
     };
   }  // namespace ordering
 }  // namespace iroha
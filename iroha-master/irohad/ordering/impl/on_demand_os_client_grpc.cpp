@@ -61,10 +61,16 @@ OnDemandOsClientGrpc::onRequestProposal(consensus::Round round) {
     log_->warn("RPC failed: {}", status.error_message());
     return boost::none;
   }
-  if (not response.has_proposal()) {
+  if (response.optional_proposal_case()
+      != proto::ProposalResponse::kProposal) {
     return boost::none;
   }
-  return proposal_factory_->build(response.proposal())
+  protocol::Proposal proposal;
+  if (not proposal.ParseFromString(response.proposal())) {
+    log_->info("Failed to parse the proposal for round {}", round);
+    return boost::none;
+  }
+  return proposal_factory_->build(std::move(proposal))
       .match(
           [&](auto &&v) {
             return boost::make_optional(
@@ -9,8 +9,8 @@
 
 #include <boost/range/adaptor/filtered.hpp>
 #include <boost/range/adaptor/transformed.hpp>
-#include "backend/protobuf/proposal.hpp"
 #include "common/bind.hpp"
+#include "interfaces/iroha_internal/proposal.hpp"
 #include "interfaces/iroha_internal/transaction_batch.hpp"
 #include "logger/logger.hpp"
 
@@ -90,9 +90,10 @@ grpc::Status OnDemandOsServerGrpc::RequestProposal(
   ordering_service_->onRequestProposal(
       {request->round().block_round(), request->round().reject_round()})
       | [&](auto &&proposal) {
-          *response->mutable_proposal() =
-              static_cast<const shared_model::proto::Proposal *>(proposal.get())
-                  ->getTransport();
+          // the blob is serialized once on proposal creation and is shared by
+          // all the requests of the round
+          const auto &blob = proposal->blob().blob();
+          response->set_proposal(blob.data(), blob.size());
         };
   return ::grpc::Status::OK;
 }
@@ -0,0 +1,125 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ordering/impl/proposal_packing_policy.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <type_traits>
+
+#include <boost/mpl/size.hpp>
+#include <boost/range/size.hpp>
+#include <boost/variant/variant.hpp>
+#include "interfaces/commands/command.hpp"
+#include "interfaces/iroha_internal/transaction_batch.hpp"
+#include "interfaces/transaction.hpp"
+#include "logger/logger.hpp"
+
+namespace {
+  /// Names of the commands in the order of the command variant types
+  const char *kCommandNames[] = {"AddAssetQuantity",
+                                 "AddPeer",
+                                 "AddSignatory",
+                                 "AppendRole",
+                                 "CreateAccount",
+                                 "CreateAsset",
+                                 "CreateDomain",
+                                 "CreateRole",
+                                 "DetachRole",
+                                 "GrantPermission",
+                                 "RemoveSignatory",
+                                 "RevokePermission",
+                                 "SetAccountDetail",
+                                 "SetQuorum",
+                                 "SubtractAssetQuantity",
+                                 "TransferAsset",
+                                 "RemovePeer",
+                                 "CompareAndSetAccountDetail"};
+
+  static_assert(
+      boost::mpl::size<shared_model::interface::Command::CommandVariantType::
+                           types>::value
+          == std::extent<decltype(kCommandNames)>::value,
+      "Each command type must have a name");
+
+  /// Cost of a command which is not listed in the command costs
+  constexpr uint64_t kDefaultCommandCost = 1;
+
+  /// @return true if the value does not exceed the limit, 0 means no limit
+  template <typename T>
+  bool withinLimit(T value, T limit) {
+    return limit == 0 or value <= limit;
+  }
+}  // namespace
+
+namespace iroha {
+  namespace ordering {
+
+    ProposalPackingPolicy::Usage &ProposalPackingPolicy::Usage::operator+=(
+        const Usage &other) {
+      transactions += other.transactions;
+      bytes += other.bytes;
+      commands += other.commands;
+      cost += other.cost;
+      return *this;
+    }
+
+    ProposalPackingPolicy::ProposalPackingPolicy(size_t max_transactions,
+                                                 ProposalBudget budget,
+                                                 logger::LoggerPtr log)
+        : max_transactions_(max_transactions),
+          budget_(std::move(budget)),
+          command_costs_(std::extent<decltype(kCommandNames)>::value,
+                         kDefaultCommandCost) {
+      for (const auto &cost : budget_.command_costs) {
+        auto name = std::find(
+            std::begin(kCommandNames), std::end(kCommandNames), cost.first);
+        if (name == std::end(kCommandNames)) {
+          log->warn("Unknown command {} in the command costs, ignoring it",
+                    cost.first);
+          continue;
+        }
+        command_costs_[std::distance(std::begin(kCommandNames), name)] =
+            cost.second;
+      }
+    }
+
+    ProposalPackingPolicy::Usage ProposalPackingPolicy::usage(
+        const shared_model::interface::TransactionBatch &batch) const {
+      Usage usage;
+      for (const auto &tx : batch.transactions()) {
+        ++usage.transactions;
+        usage.bytes += tx->blob().size();
+        auto commands = tx->commands();
+        usage.commands += boost::size(commands);
+        if (budget_.max_cost != 0) {
+          for (const auto &command : commands) {
+            usage.cost += command_costs_[command.get().which()];
+          }
+        }
+      }
+      return usage;
+    }
+
+    bool ProposalPackingPolicy::fits(const Usage &packed,
+                                     const Usage &batch) const {
+      if (packed.transactions + batch.transactions > max_transactions_) {
+        return false;
+      }
+      if (packed.transactions == 0) {
+        return true;
+      }
+      return withinLimit(packed.bytes + batch.bytes, budget_.max_bytes)
+          and withinLimit(packed.commands + batch.commands,
+                          budget_.max_commands)
+          and withinLimit(packed.cost + batch.cost, budget_.max_cost);
+    }
+
+    bool ProposalPackingPolicy::full(const Usage &packed) const {
+      return packed.transactions >= max_transactions_;
+    }
+
+  }  // namespace ordering
+}  // namespace iroha
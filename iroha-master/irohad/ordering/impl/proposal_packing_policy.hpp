@@ -0,0 +1,97 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_PROPOSAL_PACKING_POLICY_HPP
+#define IROHA_PROPOSAL_PACKING_POLICY_HPP
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include "logger/logger_fwd.hpp"
+
+namespace shared_model {
+  namespace interface {
+    class TransactionBatch;
+  }  // namespace interface
+}  // namespace shared_model
+
+namespace iroha {
+  namespace ordering {
+
+    /// Limits of a single proposal in addition to the transactions limit, 0
+    /// means no limit
+    struct ProposalBudget {
+      /// Total size of the transactions in bytes
+      size_t max_bytes = 0;
+      /// Total number of commands
+      size_t max_commands = 0;
+      /// Total estimated execution cost of the commands
+      uint64_t max_cost = 0;
+      /// Estimated execution cost by command name, e.g. "TransferAsset", the
+      /// commands which are not listed cost 1
+      std::map<std::string, uint32_t> command_costs;
+    };
+
+    /**
+     * Decides which batches are packed into a proposal, so that a proposal
+     * of a few huge transactions does not exceed the round time and a
+     * proposal of small ones uses the whole capacity. The decision depends
+     * only on the contents of the batches.
+     */
+    class ProposalPackingPolicy {
+     public:
+      /// Resources taken by batches
+      struct Usage {
+        size_t transactions = 0;
+        size_t bytes = 0;
+        size_t commands = 0;
+        uint64_t cost = 0;
+
+        Usage &operator+=(const Usage &other);
+      };
+
+      /**
+       * @param max_transactions - max number of transactions in a proposal
+       * @param budget - other limits of a proposal
+       * @param log - logger to report the unknown command names
+       */
+      ProposalPackingPolicy(size_t max_transactions,
+                            ProposalBudget budget,
+                            logger::LoggerPtr log);
+
+      /**
+       * @param batch - the batch to measure
+       * @return resources taken by the batch
+       */
+      Usage usage(const shared_model::interface::TransactionBatch &batch) const;
+
+      /**
+       * Check if the batch can be added to the proposal. The transactions
+       * limit is strict, while a batch exceeding the budget on its own is
+       * allowed into an empty proposal
+       * @param packed - resources taken by the proposal
+       * @param batch - resources taken by the batch
+       * @return true if the batch fits
+       */
+      bool fits(const Usage &packed, const Usage &batch) const;
+
+      /**
+       * @param packed - resources taken by the proposal
+       * @return true if no more transactions can be added to the proposal
+       */
+      bool full(const Usage &packed) const;
+
+     private:
+      size_t max_transactions_;
+      ProposalBudget budget_;
+      /// Cost by the index of the command type in the command variant
+      std::vector<uint64_t> command_costs_;
+    };
+
+  }  // namespace ordering
+}  // namespace iroha
+
+#endif  // IROHA_PROPOSAL_PACKING_POLICY_HPP
@@ -10,6 +10,7 @@
 #include "interfaces/iroha_internal/block.hpp"
 #include "interfaces/iroha_internal/proposal.hpp"
 #include "logger/logger.hpp"
+#include "tracing/tracer.hpp"
 
 namespace iroha {
   namespace simulator {
@@ -36,6 +37,7 @@ namespace iroha {
                   this->processProposal(*getProposalUnsafe(event));
 
               if (validated_proposal_and_errors) {
+                tracing::traceObject("proposal_verified", event.round);
                 notifier_.get_subscriber().on_next(
                     VerifiedProposalCreatorEvent{*validated_proposal_and_errors,
                                                  event.round,
@@ -55,6 +57,7 @@ namespace iroha {
               auto block = this->processVerifiedProposal(
                   proposal_and_errors, event.ledger_state->top_block_info);
               if (block) {
+                tracing::traceObject("block_created", event.round);
                 block_notifier_.get_subscriber().on_next(BlockCreatorEvent{
                     RoundData{proposal_and_errors->verified_proposal, *block},
                     event.round,
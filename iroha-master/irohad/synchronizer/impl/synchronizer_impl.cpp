@@ -13,6 +13,7 @@
 #include "common/visitor.hpp"
 #include "interfaces/iroha_internal/block.hpp"
 #include "logger/logger.hpp"
+#include "tracing/tracer.hpp"
 
 namespace iroha {
   namespace synchronizer {
@@ -39,6 +40,12 @@ namespace iroha {
     void SynchronizerImpl::processOutcome(consensus::GateObject object) {
       log_->info("processing consensus outcome");
 
+      const auto &round =
+          visit_in_place(object, [](const auto &msg) -> const auto & {
+            return msg.round;
+          });
+      tracing::traceObject("consensus_outcome", round);
+
       visit_in_place(
           object,
           [this](const consensus::PairValid &msg) { this->processNext(msg); },
@@ -54,6 +61,8 @@ namespace iroha {
           [this](const consensus::AgreementOnNone &msg) {
             this->processDifferent(msg, SynchronizationOutcomeType::kNothing);
           });
+
+      tracing::traceObject("synchronized", round);
     }
 
     ametsuchi::CommitResult SynchronizerImpl::downloadAndCommitMissingBlocks(
@@ -0,0 +1,156 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "torii/impl/admission_control.hpp"
+
+#include <algorithm>
+#include <vector>
+
+#include "cryptography/crypto_provider/crypto_verifier.hpp"
+#include "interfaces/common_objects/signature.hpp"
+#include "interfaces/transaction.hpp"
+#include "logger/logger.hpp"
+
+namespace {
+  /// Number of tracked keys after which the idle buckets are forgotten
+  constexpr size_t kMaxBuckets = 100000;
+
+  /// Add the tokens accumulated since the last update of the bucket
+  template <typename Bucket, typename TimePoint>
+  void refill(Bucket &bucket, uint32_t rate, TimePoint now) {
+    std::chrono::duration<double> elapsed = now - bucket.updated;
+    bucket.tokens =
+        std::min<double>(rate, bucket.tokens + elapsed.count() * rate);
+    bucket.updated = now;
+  }
+
+  /// @return true if the signature of the transaction is correct
+  bool verify(const shared_model::interface::Transaction &tx,
+              const shared_model::interface::Signature &signature) {
+    using Algorithm = shared_model::crypto::DefaultCryptoAlgorithmType;
+    return signature.publicKey().blob().size() == Algorithm::kPublicKeyLength
+        and signature.signedData().blob().size() == Algorithm::kSignatureLength
+        and shared_model::crypto::CryptoVerifier<>::verify(
+                signature.signedData(), tx.payload(), signature.publicKey());
+  }
+
+  /// @return true if the bucket allows the amount of transactions, a full
+  /// bucket allows a request larger than the burst
+  template <typename Bucket>
+  bool allows(const Bucket &bucket, size_t amount, uint32_t rate) {
+    return bucket.tokens >= std::min<double>(amount, rate);
+  }
+}  // namespace
+
+namespace iroha {
+  namespace torii {
+
+    AdmissionControl::AdmissionControl(AdmissionLimits limits,
+                                       logger::LoggerPtr log)
+        : limits_(limits),
+          log_(std::move(log)),
+          rejected_txs_counter_(metrics::defaultRegistry().counter(
+              "iroha_torii_rejected_transactions_total",
+              "Number of transactions rejected due to the rate limits")) {}
+
+    bool AdmissionControl::admit(
+        const shared_model::interface::types::SharedTxsCollectionType
+            &transactions,
+        const std::string &client) {
+      if (transactions.empty()
+          or (limits_.account_tx_rate == 0 and limits_.client_tx_rate == 0)) {
+        return true;
+      }
+
+      // the creator account is only claimed by the request, so the quota is
+      // taken from the account and the key of each correct signature, and a
+      // client can not exhaust the quota of the keys it does not hold
+      std::unordered_map<std::string, size_t> signer_txs;
+      if (limits_.account_tx_rate != 0) {
+        for (const auto &tx : transactions) {
+          for (const auto &signature : tx->signatures()) {
+            if (verify(*tx, signature)) {
+              ++signer_txs[tx->creatorAccountId() + "/"
+                           + signature.publicKey().hex()];
+            }
+          }
+        }
+      }
+
+      auto now = Clock::now();
+      std::lock_guard<std::mutex> lock(mutex_);
+      forgetIdle(client_buckets_, limits_.client_tx_rate, now);
+      forgetIdle(signer_buckets_, limits_.account_tx_rate, now);
+
+      Bucket *client_bucket = nullptr;
+      if (limits_.client_tx_rate != 0) {
+        client_bucket =
+            &getBucket(client_buckets_, client, limits_.client_tx_rate, now);
+        if (not allows(
+                *client_bucket, transactions.size(), limits_.client_tx_rate)) {
+          log_->warn("client {} exceeded the rate limit, rejecting {} txs",
+                     client,
+                     transactions.size());
+          rejected_txs_counter_.increment(transactions.size());
+          return false;
+        }
+      }
+
+      std::vector<std::pair<Bucket *, size_t>> taken;
+      for (const auto &signer : signer_txs) {
+        auto &bucket = getBucket(
+            signer_buckets_, signer.first, limits_.account_tx_rate, now);
+        if (not allows(bucket, signer.second, limits_.account_tx_rate)) {
+          log_->warn("signer {} exceeded the rate limit, rejecting {} txs",
+                     signer.first,
+                     transactions.size());
+          rejected_txs_counter_.increment(transactions.size());
+          return false;
+        }
+        taken.emplace_back(&bucket, signer.second);
+      }
+
+      if (client_bucket) {
+        client_bucket->tokens -= transactions.size();
+      }
+      for (auto &bucket : taken) {
+        bucket.first->tokens -= bucket.second;
+      }
+      return true;
+    }
+
+    AdmissionControl::Bucket &AdmissionControl::getBucket(
+        Buckets &buckets,
+        const std::string &key,
+        uint32_t rate,
+        Clock::time_point now) {
+      auto it = buckets.find(key);
+      if (it == buckets.end()) {
+        return buckets.emplace(key, Bucket{static_cast<double>(rate), now})
+            .first->second;
+      }
+      refill(it->second, rate, now);
+      return it->second;
+    }
+
+    void AdmissionControl::forgetIdle(Buckets &buckets,
+                                      uint32_t rate,
+                                      Clock::time_point now) {
+      if (buckets.size() < kMaxBuckets) {
+        return;
+      }
+      // full buckets are indistinguishable from the new ones
+      for (auto it = buckets.begin(); it != buckets.end();) {
+        refill(it->second, rate, now);
+        if (it->second.tokens >= rate) {
+          it = buckets.erase(it);
+        } else {
+          ++it;
+        }
+      }
+    }
+
+  }  // namespace torii
+}  // namespace iroha
@@ -0,0 +1,98 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef TORII_ADMISSION_CONTROL_HPP
+#define TORII_ADMISSION_CONTROL_HPP
+
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "interfaces/common_objects/transaction_sequence_common.hpp"
+#include "logger/logger_fwd.hpp"
+#include "metrics/metrics.hpp"
+
+namespace iroha {
+  namespace torii {
+
+    /// Rate limits of the transactions accepted by Torii, 0 means no limit
+    struct AdmissionLimits {
+      /// Transactions per second created by a single account and signed by a
+      /// single key of it
+      uint32_t account_tx_rate = 0;
+      /// Transactions per second sent from a single client address
+      uint32_t client_tx_rate = 0;
+    };
+
+    /**
+     * Sheds the load of clients and accounts which exceed their rate limits,
+     * so that a traffic spike is rejected at the entrance instead of growing
+     * the queues of the pipeline. Each limit is a token bucket which allows a
+     * burst of one second worth of transactions.
+     */
+    class AdmissionControl {
+     public:
+      AdmissionControl(AdmissionLimits limits, logger::LoggerPtr log);
+
+      /**
+       * Check the transactions of a client request against the limits and
+       * take their quota if all of them are admitted
+       * @param transactions - transactions of the request
+       * @param client - address of the client
+       * @return true if the transactions are admitted
+       */
+      bool admit(
+          const shared_model::interface::types::SharedTxsCollectionType
+              &transactions,
+          const std::string &client);
+
+     private:
+      using Clock = std::chrono::steady_clock;
+
+      struct Bucket {
+        double tokens;
+        Clock::time_point updated;
+      };
+
+      using Buckets = std::unordered_map<std::string, Bucket>;
+
+      /**
+       * Get the bucket of the key refilled with the tokens accumulated since
+       * its last update, a new bucket is full
+       * @return the bucket
+       */
+      static Bucket &getBucket(Buckets &buckets,
+                               const std::string &key,
+                               uint32_t rate,
+                               Clock::time_point now);
+
+      /**
+       * Remove the full buckets when too many keys are tracked, so that the
+       * memory is bounded
+       */
+      static void forgetIdle(Buckets &buckets,
+                             uint32_t rate,
+                             Clock::time_point now);
+
+      const AdmissionLimits limits_;
+
+      std::mutex mutex_;
+      /// Buckets by the creator account and the public key of the signer
+      Buckets signer_buckets_;
+      Buckets client_buckets_;
+
+      logger::LoggerPtr log_;
+
+      /**
+       * Number of the transactions rejected due to the rate limits
+       */
+      metrics::Counter &rejected_txs_counter_;
+    };
+
+  }  // namespace torii
+}  // namespace iroha
+
+#endif  // TORII_ADMISSION_CONTROL_HPP
@@ -5,6 +5,7 @@
 
 #include "torii/impl/command_service_impl.hpp"
 
+#include <boost/range/adaptor/indirected.hpp>
 #include "ametsuchi/block_query.hpp"
 #include "common/byteutils.hpp"
 #include "common/is_any.hpp"
@@ -13,6 +14,7 @@
 #include "interfaces/transaction.hpp"
 #include "interfaces/transaction_responses/not_received_tx_response.hpp"
 #include "logger/logger.hpp"
+#include "tracing/tracer.hpp"
 
 namespace iroha {
   namespace torii {
@@ -34,21 +36,23 @@ namespace iroha {
           tx_presence_cache_(std::move(tx_presence_cache)),
           log_(std::move(log)) {
       // Notifier for all clients
-      status_subscription_ = status_bus_->statuses().subscribe(
+      status_subscription_ = status_bus_->batches().subscribe(
           // TODO mboldyrev IR-426 research approaches to the problem of member
           // observer lifetime.
-          [cache = cache_](auto response) {
-            // find response for this tx in cache; if status of received
-            // response isn't "greater" than cached one, dismiss received one
-            auto tx_hash = response->transactionHash();
-            auto cached_tx_state = cache->findItem(tx_hash);
-            if (cached_tx_state
-                and response->comparePriorities(**cached_tx_state)
-                    != shared_model::interface::TransactionResponse::
-                           PrioritiesComparisonResult::kGreater) {
-              return;
+          [cache = cache_](const auto &batch) {
+            for (const auto &response : *batch) {
+              // find response for this tx in cache; if status of received
+              // response isn't "greater" than cached one, dismiss received one
+              auto tx_hash = response->transactionHash();
+              auto cached_tx_state = cache->findItem(tx_hash);
+              if (cached_tx_state
+                  and response->comparePriorities(**cached_tx_state)
+                      != shared_model::interface::TransactionResponse::
+                             PrioritiesComparisonResult::kGreater) {
+                continue;
+              }
+              cache->addItem(tx_hash, response);
             }
-            cache->addItem(tx_hash, response);
           });
     }
 
@@ -58,6 +62,9 @@ namespace iroha {
 
     void CommandServiceImpl::handleTransactionBatch(
         std::shared_ptr<shared_model::interface::TransactionBatch> batch) {
+      tracing::traceTransactions(
+          "torii_received",
+          batch->transactions() | boost::adaptors::indirected);
       processBatch(batch);
     }
 
@@ -155,13 +162,22 @@ namespace iroha {
             });
       }());
       return status_bus_
-          ->statuses()
+          ->batches()
+          // select statuses with requested hash, batches are scanned without
+          // emitting statuses of other transactions
+          .template lift<ResponsePtrType>(
+              [hash](rxcpp::subscriber<ResponsePtrType> dest) {
+                return rxcpp::make_subscriber<StatusBus::BatchPtr>(
+                    dest, [=](const StatusBus::BatchPtr &batch) {
+                      for (const auto &response : *batch) {
+                        if (response->transactionHash() == hash) {
+                          dest.on_next(response);
+                        }
+                      }
+                    });
+              })
           // prepend initial status
           .start_with(initial_status)
-          // select statuses with requested hash
-          .filter([hash](auto response) {
-            return response->transactionHash() == hash;
-          })
           // successfully complete the observable if final status is received.
           // final status is included in the observable
           .template lift<ResponsePtrType>(
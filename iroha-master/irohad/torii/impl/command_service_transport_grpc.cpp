@@ -23,6 +23,7 @@
 #include "interfaces/iroha_internal/tx_status_factory.hpp"
 #include "interfaces/transaction.hpp"
 #include "logger/logger.hpp"
+#include "torii/impl/admission_control.hpp"
 #include "torii/status_bus.hpp"
 
 namespace iroha {
@@ -38,6 +39,7 @@ namespace iroha {
             batch_parser,
         std::shared_ptr<shared_model::interface::TransactionBatchFactory>
             transaction_batch_factory,
+        std::shared_ptr<AdmissionControl> admission_control,
         rxcpp::observable<ConsensusGateEvent> consensus_gate_objects,
         int maximum_rounds_without_update,
         logger::LoggerPtr log)
@@ -47,6 +49,7 @@ namespace iroha {
           transaction_factory_(std::move(transaction_factory)),
           batch_parser_(std::move(batch_parser)),
           batch_factory_(std::move(transaction_batch_factory)),
+          admission_control_(std::move(admission_control)),
           log_(std::move(log)),
           consensus_gate_objects_(std::move(consensus_gate_objects)),
           maximum_rounds_without_update_(maximum_rounds_without_update) {}
@@ -92,6 +95,16 @@ namespace iroha {
                 % error % folded_hashes)
             .str();
       }
+
+      /**
+       * Strip the port from the peer of the call, so that the connections of
+       * a client share its rate limit
+       * @param peer - peer of the call in gRPC format, e.g. ipv4:127.0.0.1:1
+       * @return address of the client
+       */
+      std::string clientAddress(const std::string &peer) {
+        return peer.substr(0, peer.rfind(':'));
+      }
     }  // namespace
 
     shared_model::interface::types::SharedTxsCollectionType
@@ -119,6 +132,13 @@ namespace iroha {
         google::protobuf::Empty *response) {
       auto transactions = deserializeTransactions(request);
 
+      // the context is absent when the service is called directly
+      auto client = context ? clientAddress(context->peer()) : std::string{};
+      if (not admission_control_->admit(transactions, client)) {
+        return grpc::Status(grpc::StatusCode::RESOURCE_EXHAUSTED,
+                            "Node is overloaded, retry later");
+      }
+
       auto batches = batch_parser_->parseBatches(transactions);
 
       for (auto &batch : batches) {
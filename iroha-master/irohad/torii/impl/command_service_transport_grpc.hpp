@@ -17,7 +17,8 @@
 namespace iroha {
   namespace torii {
     class StatusBus;
-  }
+    class AdmissionControl;
+  }  // namespace torii
 }  // namespace iroha
 
 namespace shared_model {
@@ -48,6 +49,7 @@ namespace iroha {
        * @param transaction_factory - factory of transactions
        * @param batch_parser - parses of batches
        * @param transaction_batch_factory - factory of batchesof transactions
+       * @param admission_control - rejects requests exceeding the rate limits
        * @param consensus_gate_objects - events from consensus gate
        * @param maximum_rounds_without_update - defines how long tx status
        * stream is kept alive when no new tx statuses appear
@@ -63,6 +65,7 @@ namespace iroha {
               batch_parser,
           std::shared_ptr<shared_model::interface::TransactionBatchFactory>
               transaction_batch_factory,
+          std::shared_ptr<AdmissionControl> admission_control,
           rxcpp::observable<ConsensusGateEvent> consensus_gate_objects,
           int maximum_rounds_without_update,
           logger::LoggerPtr log);
@@ -132,6 +135,7 @@ namespace iroha {
           batch_parser_;
       std::shared_ptr<shared_model::interface::TransactionBatchFactory>
           batch_factory_;
+      std::shared_ptr<AdmissionControl> admission_control_;
       logger::LoggerPtr log_;
 
       rxcpp::observable<ConsensusGateEvent> consensus_gate_objects_;
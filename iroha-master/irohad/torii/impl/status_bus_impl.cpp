@@ -15,10 +15,31 @@ namespace iroha {
     }
 
     void StatusBusImpl::publish(StatusBus::Objects resp) {
-      subject_.get_subscriber().on_next(resp);
+      subject_.get_subscriber().on_next(
+          std::make_shared<const StatusBus::Batch>(1, std::move(resp)));
+    }
+
+    void StatusBusImpl::publishBatch(StatusBus::Batch batch) {
+      if (batch.empty()) {
+        return;
+      }
+      subject_.get_subscriber().on_next(
+          std::make_shared<const StatusBus::Batch>(std::move(batch)));
     }
 
     rxcpp::observable<StatusBus::Objects> StatusBusImpl::statuses() {
+      return subject_.get_observable().lift<StatusBus::Objects>(
+          [](rxcpp::subscriber<StatusBus::Objects> dest) {
+            return rxcpp::make_subscriber<StatusBus::BatchPtr>(
+                dest, [dest](const StatusBus::BatchPtr &batch) {
+                  for (const auto &object : *batch) {
+                    dest.on_next(object);
+                  }
+                });
+          });
+    }
+
+    rxcpp::observable<StatusBus::BatchPtr> StatusBusImpl::batches() {
       return subject_.get_observable();
     }
   }  // namespace torii
@@ -21,13 +21,19 @@ namespace iroha {
       ~StatusBusImpl() override;
 
       void publish(StatusBus::Objects) override;
+
+      void publishBatch(StatusBus::Batch) override;
+
       /// Subscribers will be invoked in separate thread
       rxcpp::observable<StatusBus::Objects> statuses() override;
 
+      /// Subscribers will be invoked in separate thread
+      rxcpp::observable<StatusBus::BatchPtr> batches() override;
+
       // Need to create once, otherwise will create thread for each subscriber
       rxcpp::observe_on_one_worker worker_;
       rxcpp::composite_subscription cs_;
-      rxcpp::subjects::synchronize<StatusBus::Objects, decltype(worker_)>
+      rxcpp::subjects::synchronize<StatusBus::BatchPtr, decltype(worker_)>
           subject_;
     };
   }  // namespace torii
@@ -5,13 +5,16 @@
 
 #include "torii/processor/transaction_processor_impl.hpp"
 
+#include <boost/assert.hpp>
 #include <boost/format.hpp>
+#include <boost/range/adaptor/indirected.hpp>
 
 #include "interfaces/iroha_internal/block.hpp"
 #include "interfaces/iroha_internal/proposal.hpp"
 #include "interfaces/iroha_internal/transaction_batch.hpp"
 #include "interfaces/iroha_internal/transaction_sequence.hpp"
 #include "logger/logger.hpp"
+#include "tracing/tracer.hpp"
 #include "validation/stateful_validator_common.hpp"
 
 namespace iroha {
@@ -65,57 +68,103 @@ namespace iroha {
             }
 
             const auto &proposal_and_errors = getVerifiedProposalUnsafe(event);
+            if (tracing::defaultTracer().enabled()) {
+              auto round = event.round.toString();
+              for (const auto &tx_error :
+                   proposal_and_errors->rejected_transactions) {
+                tracing::defaultTracer().record(
+                    "stateful_failed", tx_error.tx_hash.hex(), round);
+              }
+              tracing::traceTransactions(
+                  "stateful_valid",
+                  proposal_and_errors->verified_proposal->transactions(),
+                  round);
+            }
 
+            StatusBus::Batch statuses;
             // notify about failed txs
             const auto &errors = proposal_and_errors->rejected_transactions;
             for (const auto &tx_error : errors) {
               log_->info("{}", composeErrorMessage(tx_error));
-              this->publishStatus(TxStatusType::kStatefulFailed,
-                                  tx_error.tx_hash,
-                                  tx_error.error);
+              statuses.push_back(
+                  this->makeStatus(TxStatusType::kStatefulFailed,
+                                   tx_error.tx_hash,
+                                   tx_error.error));
             }
             // notify about success txs
             for (const auto &successful_tx :
                  proposal_and_errors->verified_proposal->transactions()) {
               log_->info("VerifiedProposalCreatorEvent StatefulValid: {}",
                          successful_tx.hash().hex());
-              this->publishStatus(TxStatusType::kStatefulValid,
-                                  successful_tx.hash());
+              statuses.push_back(this->makeStatus(TxStatusType::kStatefulValid,
+                                                  successful_tx.hash()));
             }
+            status_bus_->publishBatch(std::move(statuses));
           });
 
       // commit transactions
       commits.subscribe(
           // on next
           [this](auto block) {
+            if (tracing::defaultTracer().enabled()) {
+              tracing::traceTransactions(
+                  "committed",
+                  block->transactions(),
+                  "height " + std::to_string(block->height()));
+            }
+            StatusBus::Batch statuses;
             for (const auto &tx : block->transactions()) {
               const auto &hash = tx.hash();
               log_->debug("Committed transaction: {}", hash.hex());
-              this->publishStatus(TxStatusType::kCommitted, hash);
+              statuses.push_back(
+                  this->makeStatus(TxStatusType::kCommitted, hash));
             }
             for (const auto &rejected_tx_hash :
                  block->rejected_transactions_hashes()) {
               log_->debug("Rejected transaction: {}", rejected_tx_hash.hex());
-              this->publishStatus(TxStatusType::kRejected, rejected_tx_hash);
+              statuses.push_back(
+                  this->makeStatus(TxStatusType::kRejected, rejected_tx_hash));
             }
+            status_bus_->publishBatch(std::move(statuses));
           });
 
       mst_processor_->onStateUpdate().subscribe([this](auto &&state) {
         log_->info("MST state updated");
-        state->iterateTransactions([this](const auto &tx) {
-          this->publishStatus(TxStatusType::kMstPending, tx->hash());
+        StatusBus::Batch statuses;
+        state->iterateTransactions([this, &statuses](const auto &tx) {
+          statuses.push_back(
+              this->makeStatus(TxStatusType::kMstPending, tx->hash()));
         });
+        status_bus_->publishBatch(std::move(statuses));
       });
       mst_processor_->onPreparedBatches().subscribe([this](auto &&batch) {
         log_->info("MST batch prepared");
+        tracing::traceTransactions(
+            "mst_prepared",
+            batch->transactions() | boost::adaptors::indirected);
         this->publishEnoughSignaturesStatus(batch->transactions());
         this->pcs_->propagate_batch(batch);
       });
       mst_processor_->onExpiredBatches().subscribe([this](auto &&batch) {
         log_->info("MST batch {} is expired", batch->reducedHash());
+        StatusBus::Batch statuses;
+        for (auto &&tx : batch->transactions()) {
+          statuses.push_back(
+              this->makeStatus(TxStatusType::kMstExpired, tx->hash()));
+        }
+        status_bus_->publishBatch(std::move(statuses));
+      });
+      pcs_->onExpiredBatches().subscribe([this](auto &&batch) {
+        log_->info("Batch {} expired in ordering", batch->reducedHash());
+        StatusBus::Batch statuses;
         for (auto &&tx : batch->transactions()) {
-          this->publishStatus(TxStatusType::kMstExpired, tx->hash());
+          statuses.push_back(this->makeStatus(
+              TxStatusType::kStatelessFailed,
+              tx->hash(),
+              validation::CommandError{
+                  "Transaction expired in ordering", 0, "", false}));
         }
+        status_bus_->publishBatch(std::move(statuses));
       });
     }
 
@@ -126,15 +175,21 @@ namespace iroha {
       if (transaction_batch->hasAllSignatures()
           and not mst_processor_->batchInStorage(transaction_batch)) {
         log_->info("propagating batch to PCS");
+        tracing::traceTransactions(
+            "propagated_to_ordering",
+            transaction_batch->transactions() | boost::adaptors::indirected);
         this->publishEnoughSignaturesStatus(transaction_batch->transactions());
         pcs_->propagate_batch(transaction_batch);
       } else {
         log_->info("propagating batch to MST");
+        tracing::traceTransactions(
+            "propagated_to_mst",
+            transaction_batch->transactions() | boost::adaptors::indirected);
         mst_processor_->propagateBatch(transaction_batch);
       }
     }
 
-    void TransactionProcessorImpl::publishStatus(
+    StatusBus::Objects TransactionProcessorImpl::makeStatus(
         TxStatusType tx_status,
         const shared_model::crypto::Hash &hash,
         const validation::CommandError &cmd_error) const {
@@ -144,61 +199,49 @@ namespace iroha {
                 cmd_error.name, cmd_error.index, cmd_error.error_code};
       switch (tx_status) {
         case TxStatusType::kStatelessFailed: {
-          status_bus_->publish(
-              status_factory_->makeStatelessFail(hash, tx_error));
-          return;
+          return status_factory_->makeStatelessFail(hash, tx_error);
         };
         case TxStatusType::kStatelessValid: {
-          status_bus_->publish(
-              status_factory_->makeStatelessValid(hash, tx_error));
-          return;
+          return status_factory_->makeStatelessValid(hash, tx_error);
         };
         case TxStatusType::kStatefulFailed: {
-          status_bus_->publish(
-              status_factory_->makeStatefulFail(hash, tx_error));
-          return;
+          return status_factory_->makeStatefulFail(hash, tx_error);
         };
         case TxStatusType::kStatefulValid: {
-          status_bus_->publish(
-              status_factory_->makeStatefulValid(hash, tx_error));
-          return;
+          return status_factory_->makeStatefulValid(hash, tx_error);
         };
         case TxStatusType::kRejected: {
-          status_bus_->publish(status_factory_->makeRejected(hash, tx_error));
-          return;
+          return status_factory_->makeRejected(hash, tx_error);
         };
         case TxStatusType::kCommitted: {
-          status_bus_->publish(status_factory_->makeCommitted(hash, tx_error));
-          return;
+          return status_factory_->makeCommitted(hash, tx_error);
         };
         case TxStatusType::kMstExpired: {
-          status_bus_->publish(status_factory_->makeMstExpired(hash, tx_error));
-          return;
+          return status_factory_->makeMstExpired(hash, tx_error);
         };
         case TxStatusType::kNotReceived: {
-          status_bus_->publish(
-              status_factory_->makeNotReceived(hash, tx_error));
-          return;
+          return status_factory_->makeNotReceived(hash, tx_error);
         };
         case TxStatusType::kMstPending: {
-          status_bus_->publish(status_factory_->makeMstPending(hash, tx_error));
-          return;
+          return status_factory_->makeMstPending(hash, tx_error);
         };
         case TxStatusType::kEnoughSignaturesCollected: {
-          status_bus_->publish(
-              status_factory_->makeEnoughSignaturesCollected(hash, tx_error));
-          return;
+          return status_factory_->makeEnoughSignaturesCollected(hash, tx_error);
         };
       }
+      BOOST_ASSERT_MSG(false, "Unknown transaction status type");
+      return nullptr;
     }
 
     void TransactionProcessorImpl::publishEnoughSignaturesStatus(
         const shared_model::interface::types::SharedTxsCollectionType &txs)
         const {
+      StatusBus::Batch statuses;
       for (const auto &tx : txs) {
-        this->publishStatus(TxStatusType::kEnoughSignaturesCollected,
-                            tx->hash());
+        statuses.push_back(this->makeStatus(
+            TxStatusType::kEnoughSignaturesCollected, tx->hash()));
       }
+      status_bus_->publishBatch(std::move(statuses));
     }
   }  // namespace torii
 }  // namespace iroha
@@ -67,9 +67,9 @@ namespace iroha {
 
       logger::LoggerPtr log_;
 
-      // TODO: [IR-1665] Akvinikym 29.08.18: Refactor method publishStatus(..)
+      // TODO: [IR-1665] Akvinikym 29.08.18: Refactor method makeStatus(..)
       /**
-       * Complementary class for publishStatus method
+       * Complementary class for makeStatus method
        */
       enum class TxStatusType {
         kStatelessFailed,
@@ -84,15 +84,16 @@ namespace iroha {
         kEnoughSignaturesCollected
       };
       /**
-       * Publish status of transaction
-       * @param tx_status to be published
+       * Create status of transaction
+       * @param tx_status to be created
        * @param hash of that transaction
        * @param cmd_error, which can appear during validation
+       * @return created status
        */
-      void publishStatus(TxStatusType tx_status,
-                         const shared_model::crypto::Hash &hash,
-                         const validation::CommandError &cmd_error =
-                             validation::CommandError{}) const;
+      StatusBus::Objects makeStatus(TxStatusType tx_status,
+                                    const shared_model::crypto::Hash &hash,
+                                    const validation::CommandError &cmd_error =
+                                        validation::CommandError{}) const;
 
       /**
        * Publish kEnoughSignaturesCollected status for each transaction in
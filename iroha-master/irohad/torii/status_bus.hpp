@@ -6,6 +6,8 @@
 #ifndef TORII_STATUS_BUS
 #define TORII_STATUS_BUS
 
+#include <vector>
+
 #include <rxcpp/rx.hpp>
 #include "interfaces/transaction_responses/tx_response.hpp"
 
@@ -22,6 +24,10 @@ namespace iroha {
       using Objects =
           std::shared_ptr<shared_model::interface::TransactionResponse>;
 
+      /// Statuses published as a single event, e.g. of a whole block
+      using Batch = std::vector<Objects>;
+      using BatchPtr = std::shared_ptr<const Batch>;
+
       /**
        * Shares object among the bus subscribers
        * @param object to share
@@ -29,10 +35,23 @@ namespace iroha {
        */
       virtual void publish(Objects) = 0;
 
+      /**
+       * Shares objects among the bus subscribers as a single event
+       * @param objects to share
+       * note: guaranteed to be non-blocking call
+       */
+      virtual void publishBatch(Batch) = 0;
+
       /**
        * @return observable over objects in bus
        */
       virtual rxcpp::observable<Objects> statuses() = 0;
+
+      /**
+       * @return observable over published batches, an object published alone
+       * is emitted as a batch of one object
+       */
+      virtual rxcpp::observable<BatchPtr> batches() = 0;
     };
   }  // namespace torii
 }  // namespace iroha
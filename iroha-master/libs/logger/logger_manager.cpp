@@ -33,11 +33,14 @@ namespace logger {
   LoggerManagerTreePtr LoggerManagerTree::registerChild(
       std::string tag,
       boost::optional<LogLevel> log_level,
-      boost::optional<LogPatterns> patterns) {
+      boost::optional<LogPatterns> patterns,
+      boost::optional<uint32_t> rate_limit) {
     LoggerConfig child_config{
         log_level.value_or(config_->log_level),
         patterns ? std::move(patterns)->inherit(config_->patterns)
-                 : config_->patterns};
+                 : config_->patterns,
+        rate_limit.value_or(config_->rate_limit),
+        config_->sinks};
     // Operator new is employed due to private visibility of used constructor.
     LoggerManagerTreePtr child(new LoggerManagerTree(
         joinTags(full_tag_, tag),
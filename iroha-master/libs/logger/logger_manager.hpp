@@ -36,10 +36,12 @@ namespace logger {
      * @param tag - the child's tag, without any parents' prefixes
      * @param log_level - override the log level for the new child
      * @param patterns - override the patterns
+     * @param rate_limit - override the rate limit
      */
     LoggerManagerTreePtr registerChild(std::string tag,
                                        boost::optional<LogLevel> log_level,
-                                       boost::optional<LogPatterns> patterns);
+                                       boost::optional<LogPatterns> patterns,
+                                       boost::optional<uint32_t> rate_limit);
 
     /// Get this node's logger. Thread safe.
     LoggerPtr getLogger();
@@ -6,11 +6,16 @@
 #include "logger/logger_spdlog.hpp"
 
 #include <atomic>
+#include <chrono>
 #include <ciso646>
 #include <mutex>
+#include <unordered_map>
+#include <vector>
 
 #define SPDLOG_FMT_EXTERNAL
 
+#include <spdlog/async.h>
+#include <spdlog/sinks/rotating_file_sink.h>
 #include <spdlog/sinks/stdout_color_sinks.h>
 #include <spdlog/spdlog.h>
 #include <boost/assert.hpp>
@@ -37,10 +42,86 @@ namespace {
     }
   }
 
-  std::shared_ptr<spdlog::logger> getOrCreateLogger(const std::string tag) {
+  /**
+   * Get the rotating file sink for the configured path. The sink is shared by
+   * all loggers, so it uses a single detailed pattern.
+   */
+  spdlog::sink_ptr getFileSink(const logger::LogSinkConfig &config) {
+    static std::mutex mutex;
+    static std::unordered_map<std::string, spdlog::sink_ptr> file_sinks;
+    std::lock_guard<std::mutex> lock(mutex);
+    auto &sink = file_sinks[*config.file_path];
+    if (not sink) {
+      sink = std::make_shared<spdlog::sinks::rotating_file_sink_mt>(
+          *config.file_path, config.file_max_size, config.file_max_files);
+      sink->set_pattern(
+          logger::getDefaultLogPatterns().getPattern(logger::LogLevel::kTrace));
+    }
+    return sink;
+  }
+
+  /// Get the thread pool of asynchronous loggers, created on the first call.
+  std::shared_ptr<spdlog::details::thread_pool> getThreadPool(
+      size_t queue_size) {
+    static std::mutex mutex;
+    std::lock_guard<std::mutex> lock(mutex);
+    auto thread_pool = spdlog::thread_pool();
+    if (not thread_pool) {
+      spdlog::init_thread_pool(queue_size, 1);
+      thread_pool = spdlog::thread_pool();
+    }
+    return thread_pool;
+  }
+
+  spdlog::async_overflow_policy getSpdlogOverflowPolicy(
+      logger::LogOverflowPolicy policy) {
+    switch (policy) {
+      case logger::LogOverflowPolicy::kBlock:
+        return spdlog::async_overflow_policy::block;
+      case logger::LogOverflowPolicy::kDropOldest:
+        return spdlog::async_overflow_policy::overrun_oldest;
+      default:
+        BOOST_ASSERT_MSG(false, "Unknown overflow policy!");
+        return spdlog::async_overflow_policy::block;
+    }
+  }
+
+  /**
+   * Create and register a logger writing to the console and optionally to a
+   * file, either synchronously or through the shared asynchronous queue.
+   * Throws spdlog::spdlog_ex if a logger with this tag is already registered.
+   */
+  std::shared_ptr<spdlog::logger> createLogger(
+      const std::string &tag, const logger::LogSinkConfig &config) {
+    std::vector<spdlog::sink_ptr> sinks{
+        std::make_shared<spdlog::sinks::stdout_color_sink_mt>()};
+    if (config.file_path) {
+      sinks.push_back(getFileSink(config));
+    }
+    std::shared_ptr<spdlog::logger> logger;
+    if (config.async_queue_size == 0) {
+      logger =
+          std::make_shared<spdlog::logger>(tag, sinks.begin(), sinks.end());
+    } else {
+      logger = std::make_shared<spdlog::async_logger>(
+          tag,
+          sinks.begin(),
+          sinks.end(),
+          getThreadPool(config.async_queue_size),
+          getSpdlogOverflowPolicy(config.overflow_policy));
+    }
+    // buffered file output must not lose the messages preceding a failure
+    logger->flush_on(spdlog::level::warn);
+    spdlog::register_logger(logger);
+    return logger;
+  }
+
+  std::shared_ptr<spdlog::logger> getOrCreateLogger(
+      const std::string tag, const logger::LoggerConfig &config) {
     std::shared_ptr<spdlog::logger> logger;
     try {
-      logger = spdlog::stdout_color_mt(tag);
+      logger = config.sinks ? createLogger(tag, *config.sinks)
+                            : spdlog::stdout_color_mt(tag);
     } catch (const spdlog::spdlog_ex &) {
       logger = spdlog::get(tag);
     }
@@ -91,13 +172,24 @@ namespace logger {
   }
 
   LoggerSpdlog::LoggerSpdlog(std::string tag, ConstLoggerConfigPtr config)
-      : tag_(tag), config_(std::move(config)), logger_(getOrCreateLogger(tag)) {
+      : tag_(tag),
+        config_(std::move(config)),
+        logger_(getOrCreateLogger(tag, *config_)),
+        window_start_(0),
+        window_count_(0),
+        dropped_(0) {
     setupLogger();
   }
 
   void LoggerSpdlog::setupLogger() {
     logger_->set_level(getSpdlogLogLevel(config_->log_level));
-    logger_->set_pattern(config_->patterns.getPattern(config_->log_level));
+    auto pattern = config_->patterns.getPattern(config_->log_level);
+    if (config_->sinks) {
+      // the file sink is shared by all loggers and keeps its own pattern
+      logger_->sinks().front()->set_pattern(pattern);
+    } else {
+      logger_->set_pattern(pattern);
+    }
   }
 
   void LoggerSpdlog::logInternal(Level level, const std::string &s) const {
@@ -105,6 +197,41 @@ namespace logger {
   }
 
   bool LoggerSpdlog::shouldLog(Level level) const {
-    return config_->log_level <= level;
+    if (config_->log_level > level) {
+      return false;
+    }
+    // warnings and errors are never dropped
+    if (config_->rate_limit == 0 or level >= LogLevel::kWarn) {
+      return true;
+    }
+    return acquireRateLimit();
+  }
+
+  bool LoggerSpdlog::acquireRateLimit() const {
+    const int64_t now = std::chrono::duration_cast<std::chrono::seconds>(
+                            std::chrono::steady_clock::now().time_since_epoch())
+                            .count();
+    auto window_start = window_start_.load(std::memory_order_relaxed);
+    // the counters are reset without a lock, so the limit is approximate at
+    // window boundaries
+    if (window_start != now
+        and window_start_.compare_exchange_strong(
+                window_start, now, std::memory_order_relaxed)) {
+      window_count_.store(0, std::memory_order_relaxed);
+      if (auto dropped = dropped_.exchange(0, std::memory_order_relaxed)) {
+        logInternal(
+            LogLevel::kWarn,
+            fmt::format("{} messages were dropped by the rate limit of {} "
+                        "messages per second",
+                        dropped,
+                        config_->rate_limit));
+      }
+    }
+    if (window_count_.fetch_add(1, std::memory_order_relaxed)
+        < config_->rate_limit) {
+      return true;
+    }
+    dropped_.fetch_add(1, std::memory_order_relaxed);
+    return false;
   }
 }  // namespace logger
@@ -8,10 +8,14 @@
 
 #include "logger/logger.hpp"
 
+#include <atomic>
+#include <cstdint>
 #include <map>
 #include <memory>
 #include <string>
 
+#include <boost/optional.hpp>
+
 namespace spdlog {
   class logger;
 }
@@ -45,10 +49,33 @@ namespace logger {
     std::map<LogLevel, std::string> patterns_;
   };
 
-  // TODO mboldyrev 29.12.2018 IR-188 Add sink options (console, file, syslog)
+  /// Behaviour of the asynchronous logging queue when it is full.
+  enum class LogOverflowPolicy {
+    kBlock,       ///< wait until the queue has a free slot
+    kDropOldest,  ///< overwrite the oldest queued message
+  };
+
+  /// Output options of the whole logger tree.
+  struct LogSinkConfig {
+    /// Log file written in addition to the console, if set
+    boost::optional<std::string> file_path;
+    /// Size of the log file in bytes at which it is rotated
+    uint32_t file_max_size = 100 * 1024 * 1024;
+    /// Number of rotated log files kept besides the current one
+    uint32_t file_max_files = 3;
+    /// Capacity of the asynchronous logging queue, 0 makes logging synchronous
+    uint32_t async_queue_size = 0;
+    LogOverflowPolicy overflow_policy = LogOverflowPolicy::kBlock;
+  };
+
   struct LoggerConfig {
     LogLevel log_level;
     LogPatterns patterns;
+    /// Maximum number of messages less severe than warnings logged per second,
+    /// 0 disables the limit
+    uint32_t rate_limit = 0;
+    /// Output options, synchronous console logging is used if not set
+    std::shared_ptr<const LogSinkConfig> sinks;
   };
 
   class LoggerSpdlog : public Logger {
@@ -69,9 +96,24 @@ namespace logger {
     /// Set Spdlog logger level and pattern.
     void setupLogger();
 
+    /**
+     * Count a message against the rate limit of the current second. When a
+     * new second starts, the number of messages dropped during the previous
+     * ones is reported.
+     * @return true if the message fits into the limit
+     */
+    bool acquireRateLimit() const;
+
     const std::string tag_;
     const ConstLoggerConfigPtr config_;
     const std::shared_ptr<spdlog::logger> logger_;
+
+    /// Rate limiting window start, in seconds of the steady clock
+    mutable std::atomic<int64_t> window_start_;
+    /// Number of messages counted in the current window
+    mutable std::atomic<uint32_t> window_count_;
+    /// Number of messages dropped since the last report
+    mutable std::atomic<uint32_t> dropped_;
   };
 
 }  // namespace logger
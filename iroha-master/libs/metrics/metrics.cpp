@@ -0,0 +1,192 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "metrics/metrics.hpp"
+
+#include <algorithm>
+#include <ciso646>
+#include <iomanip>
+#include <limits>
+#include <sstream>
+
+#include <boost/assert.hpp>
+
+namespace iroha {
+  namespace metrics {
+
+    Counter::Counter() : value_(0) {}
+
+    void Counter::increment(uint64_t value) {
+      value_.fetch_add(value, std::memory_order_relaxed);
+    }
+
+    uint64_t Counter::value() const {
+      return value_.load(std::memory_order_relaxed);
+    }
+
+    Gauge::Gauge() : value_(0) {}
+
+    void Gauge::set(int64_t value) {
+      value_.store(value, std::memory_order_relaxed);
+    }
+
+    void Gauge::add(int64_t value) {
+      value_.fetch_add(value, std::memory_order_relaxed);
+    }
+
+    int64_t Gauge::value() const {
+      return value_.load(std::memory_order_relaxed);
+    }
+
+    Histogram::Histogram(std::vector<double> bounds)
+        : bounds_(std::move(bounds)),
+          counts_(new std::atomic<uint64_t>[bounds_.size() + 1]),
+          sum_(0) {
+      BOOST_ASSERT_MSG(std::is_sorted(bounds_.begin(), bounds_.end()),
+                       "Histogram bounds must be sorted");
+      for (size_t i = 0; i <= bounds_.size(); ++i) {
+        counts_[i].store(0, std::memory_order_relaxed);
+      }
+    }
+
+    void Histogram::observe(double value) {
+      auto bucket = std::lower_bound(bounds_.begin(), bounds_.end(), value)
+          - bounds_.begin();
+      counts_[bucket].fetch_add(1, std::memory_order_relaxed);
+      auto sum = sum_.load(std::memory_order_relaxed);
+      while (not sum_.compare_exchange_weak(
+          sum, sum + value, std::memory_order_relaxed)) {
+      }
+    }
+
+    const std::vector<double> &Histogram::bounds() const {
+      return bounds_;
+    }
+
+    std::vector<uint64_t> Histogram::bucketCounts() const {
+      std::vector<uint64_t> counts;
+      counts.reserve(bounds_.size() + 1);
+      for (size_t i = 0; i <= bounds_.size(); ++i) {
+        counts.push_back(counts_[i].load(std::memory_order_relaxed));
+      }
+      return counts;
+    }
+
+    double Histogram::sum() const {
+      return sum_.load(std::memory_order_relaxed);
+    }
+
+    std::vector<double> exponentialBounds(double start,
+                                          double factor,
+                                          size_t count) {
+      std::vector<double> bounds;
+      bounds.reserve(count);
+      for (auto bound = start; bounds.size() < count; bound *= factor) {
+        bounds.push_back(bound);
+      }
+      return bounds;
+    }
+
+    std::vector<double> durationBounds() {
+      return {0.001, 0.0025, 0.005, 0.01, 0.025, 0.05, 0.1, 0.25, 0.5, 1,
+              2.5,   5,      10};
+    }
+
+    ScopedTimer::ScopedTimer(Histogram &histogram)
+        : histogram_(histogram), start_(std::chrono::steady_clock::now()) {}
+
+    ScopedTimer::~ScopedTimer() {
+      histogram_.observe(std::chrono::duration<double>(
+                             std::chrono::steady_clock::now() - start_)
+                             .count());
+    }
+
+    Counter &Registry::counter(const std::string &name,
+                               const std::string &help) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      auto &metric = family(name, help);
+      BOOST_ASSERT_MSG(not metric.gauge and not metric.histogram,
+                       "Metric is registered with another type");
+      if (not metric.counter) {
+        metric.counter = std::make_unique<Counter>();
+      }
+      return *metric.counter;
+    }
+
+    Gauge &Registry::gauge(const std::string &name, const std::string &help) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      auto &metric = family(name, help);
+      BOOST_ASSERT_MSG(not metric.counter and not metric.histogram,
+                       "Metric is registered with another type");
+      if (not metric.gauge) {
+        metric.gauge = std::make_unique<Gauge>();
+      }
+      return *metric.gauge;
+    }
+
+    Histogram &Registry::histogram(const std::string &name,
+                                   const std::string &help,
+                                   std::vector<double> bounds) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      auto &metric = family(name, help);
+      BOOST_ASSERT_MSG(not metric.counter and not metric.gauge,
+                       "Metric is registered with another type");
+      if (not metric.histogram) {
+        metric.histogram = std::make_unique<Histogram>(std::move(bounds));
+      }
+      return *metric.histogram;
+    }
+
+    std::string Registry::serialize() const {
+      std::ostringstream out;
+      // the values are printed exactly, so that the sums are not rounded
+      out << std::setprecision(std::numeric_limits<double>::max_digits10);
+      std::lock_guard<std::mutex> lock(mutex_);
+      for (const auto &named_family : families_) {
+        const auto &name = named_family.first;
+        const auto &metric = named_family.second;
+        out << "# HELP " << name << " " << metric.help << "\n";
+        if (metric.counter) {
+          out << "# TYPE " << name << " counter\n"
+              << name << " " << metric.counter->value() << "\n";
+        } else if (metric.gauge) {
+          out << "# TYPE " << name << " gauge\n"
+              << name << " " << metric.gauge->value() << "\n";
+        } else if (metric.histogram) {
+          out << "# TYPE " << name << " histogram\n";
+          const auto &bounds = metric.histogram->bounds();
+          const auto counts = metric.histogram->bucketCounts();
+          // Prometheus buckets are cumulative
+          uint64_t count = 0;
+          for (size_t i = 0; i < bounds.size(); ++i) {
+            count += counts[i];
+            out << name << "_bucket{le=\"" << bounds[i] << "\"} " << count
+                << "\n";
+          }
+          count += counts.back();
+          out << name << "_bucket{le=\"+Inf\"} " << count << "\n"
+              << name << "_sum " << metric.histogram->sum() << "\n"
+              << name << "_count " << count << "\n";
+        }
+      }
+      return out.str();
+    }
+
+    Registry::Family &Registry::family(const std::string &name,
+                                       const std::string &help) {
+      auto &metric = families_[name];
+      if (metric.help.empty()) {
+        metric.help = help;
+      }
+      return metric;
+    }
+
+    Registry &defaultRegistry() {
+      static Registry registry;
+      return registry;
+    }
+
+  }  // namespace metrics
+}  // namespace iroha
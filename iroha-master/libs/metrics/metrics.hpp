@@ -0,0 +1,173 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_METRICS_HPP
+#define IROHA_METRICS_HPP
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace iroha {
+  namespace metrics {
+
+    /**
+     * Monotonically increasing value, e.g. number of processed requests.
+     * Updates are lock-free.
+     */
+    class Counter {
+     public:
+      Counter();
+
+      /// Add the value to the counter
+      void increment(uint64_t value = 1);
+
+      uint64_t value() const;
+
+     private:
+      std::atomic<uint64_t> value_;
+    };
+
+    /**
+     * Value which can go up and down, e.g. size of a queue. Updates are
+     * lock-free.
+     */
+    class Gauge {
+     public:
+      Gauge();
+
+      void set(int64_t value);
+
+      /// Add the value to the gauge, the value can be negative
+      void add(int64_t value);
+
+      int64_t value() const;
+
+     private:
+      std::atomic<int64_t> value_;
+    };
+
+    /**
+     * Distribution of observed values over the fixed buckets, e.g. durations
+     * of an operation. Updates are lock-free.
+     */
+    class Histogram {
+     public:
+      /**
+       * @param bounds - sorted upper bounds of the buckets, the bucket for
+       * values above the last bound is added implicitly
+       */
+      explicit Histogram(std::vector<double> bounds);
+
+      void observe(double value);
+
+      const std::vector<double> &bounds() const;
+
+      /// @return number of observations in each bucket, the last element is
+      /// the number of observations above the last bound
+      std::vector<uint64_t> bucketCounts() const;
+
+      /// @return sum of the observed values
+      double sum() const;
+
+     private:
+      const std::vector<double> bounds_;
+      std::unique_ptr<std::atomic<uint64_t>[]> counts_;
+      std::atomic<double> sum_;
+    };
+
+    /**
+     * Make exponentially growing histogram bounds
+     * @param start - the first bound
+     * @param factor - ratio of the consecutive bounds
+     * @param count - number of bounds
+     * @return the bounds
+     */
+    std::vector<double> exponentialBounds(double start,
+                                          double factor,
+                                          size_t count);
+
+    /// @return histogram bounds for durations in seconds, from 1 ms to 10 s
+    std::vector<double> durationBounds();
+
+    /**
+     * Observes the time between its construction and destruction in seconds
+     */
+    class ScopedTimer {
+     public:
+      explicit ScopedTimer(Histogram &histogram);
+
+      ~ScopedTimer();
+
+     private:
+      Histogram &histogram_;
+      const std::chrono::steady_clock::time_point start_;
+    };
+
+    /**
+     * Named collection of metrics, serialized in Prometheus text format.
+     * Metrics are registered once under a mutex and live as long as the
+     * registry, so that the components keep references to them and update
+     * them without locking.
+     */
+    class Registry {
+     public:
+      /**
+       * Get the counter with the given name, creating it if needed
+       * @param name - metric name
+       * @param help - description of the metric
+       * @return the counter
+       */
+      Counter &counter(const std::string &name, const std::string &help);
+
+      /**
+       * Get the gauge with the given name, creating it if needed
+       * @param name - metric name
+       * @param help - description of the metric
+       * @return the gauge
+       */
+      Gauge &gauge(const std::string &name, const std::string &help);
+
+      /**
+       * Get the histogram with the given name, creating it if needed
+       * @param name - metric name
+       * @param help - description of the metric
+       * @param bounds - bucket bounds, ignored if the histogram exists
+       * @return the histogram
+       */
+      Histogram &histogram(const std::string &name,
+                           const std::string &help,
+                           std::vector<double> bounds = durationBounds());
+
+      /// @return all the metrics in Prometheus text exposition format
+      std::string serialize() const;
+
+     private:
+      struct Family {
+        std::string help;
+        std::unique_ptr<Counter> counter;
+        std::unique_ptr<Gauge> gauge;
+        std::unique_ptr<Histogram> histogram;
+      };
+
+      /// Get or create the family, has to be called with mutex_ locked
+      Family &family(const std::string &name, const std::string &help);
+
+      std::map<std::string, Family> families_;
+      mutable std::mutex mutex_;
+    };
+
+    /// @return the registry of the process, which is exported by irohad
+    Registry &defaultRegistry();
+
+  }  // namespace metrics
+}  // namespace iroha
+
+#endif  // IROHA_METRICS_HPP
@@ -0,0 +1,117 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "metrics/metrics_server.hpp"
+
+#include <ciso646>
+
+#include <boost/asio/read_until.hpp>
+#include <boost/asio/streambuf.hpp>
+#include <boost/asio/write.hpp>
+#include "logger/logger.hpp"
+#include "metrics/metrics.hpp"
+
+using boost::asio::ip::tcp;
+
+namespace {
+  /// Maximum size of the request headers, larger requests are dropped
+  constexpr size_t kMaxRequestSize = 8 * 1024;
+}  // namespace
+
+namespace iroha {
+  namespace metrics {
+
+    MetricsServer::MetricsServer(const Registry &registry,
+                                 logger::LoggerPtr log)
+        : registry_(registry), log_(std::move(log)), acceptor_(io_service_) {}
+
+    MetricsServer::~MetricsServer() {
+      io_service_.stop();
+      if (thread_.joinable()) {
+        thread_.join();
+      }
+    }
+
+    expected::Result<uint16_t, std::string> MetricsServer::run(
+        const std::string &ip, uint16_t port) {
+      boost::system::error_code error;
+      auto address = boost::asio::ip::address::from_string(ip, error);
+      if (error) {
+        return expected::makeError("Wrong metrics address " + ip + ": "
+                                   + error.message());
+      }
+      tcp::endpoint endpoint(address, port);
+      acceptor_.open(endpoint.protocol(), error);
+      if (not error) {
+        acceptor_.set_option(tcp::acceptor::reuse_address(true), error);
+      }
+      if (not error) {
+        acceptor_.bind(endpoint, error);
+      }
+      if (not error) {
+        acceptor_.listen(tcp::acceptor::max_connections, error);
+      }
+      if (error) {
+        return expected::makeError("Failed to listen on " + ip + ":"
+                                   + std::to_string(port) + ": "
+                                   + error.message());
+      }
+      auto bound_port = acceptor_.local_endpoint().port();
+      accept();
+      thread_ = std::thread([this] { io_service_.run(); });
+      log_->info("serving metrics on port {}", bound_port);
+      return expected::makeValue(bound_port);
+    }
+
+    void MetricsServer::accept() {
+      auto socket = std::make_shared<tcp::socket>(io_service_);
+      acceptor_.async_accept(
+          *socket, [this, socket](const boost::system::error_code &error) {
+            if (error == boost::asio::error::operation_aborted) {
+              return;
+            }
+            if (error) {
+              log_->warn("failed to accept connection: {}", error.message());
+            } else {
+              this->respond(std::move(socket));
+            }
+            this->accept();
+          });
+    }
+
+    void MetricsServer::respond(std::shared_ptr<tcp::socket> socket) {
+      auto request = std::make_shared<boost::asio::streambuf>(kMaxRequestSize);
+      boost::asio::async_read_until(
+          *socket,
+          *request,
+          "\r\n\r\n",
+          [this, socket, request](const boost::system::error_code &error,
+                                  size_t) {
+            if (error) {
+              log_->debug("failed to read request: {}", error.message());
+              return;
+            }
+            auto body = registry_.serialize();
+            auto response = std::make_shared<std::string>(
+                "HTTP/1.1 200 OK\r\n"
+                "Content-Type: text/plain; version=0.0.4\r\n"
+                "Content-Length: "
+                + std::to_string(body.size())
+                + "\r\n"
+                  "Connection: close\r\n\r\n"
+                + body);
+            boost::asio::async_write(
+                *socket,
+                boost::asio::buffer(*response),
+                [socket, response](const boost::system::error_code &,
+                                   size_t) {
+                  boost::system::error_code ignored;
+                  socket->shutdown(tcp::socket::shutdown_both, ignored);
+                });
+          });
+    }
+
+  }  // namespace metrics
+}  // namespace iroha
@@ -0,0 +1,65 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_METRICS_SERVER_HPP
+#define IROHA_METRICS_SERVER_HPP
+
+#include <memory>
+#include <string>
+#include <thread>
+
+#include <boost/asio/io_service.hpp>
+#include <boost/asio/ip/tcp.hpp>
+#include "common/result.hpp"
+#include "logger/logger_fwd.hpp"
+
+namespace iroha {
+  namespace metrics {
+
+    class Registry;
+
+    /**
+     * Minimal HTTP server which responds to every request with the metrics
+     * of the registry in Prometheus text format. Connections are served
+     * asynchronously on a dedicated thread.
+     */
+    class MetricsServer {
+     public:
+      /**
+       * @param registry - the metrics to export
+       * @param log - logger
+       */
+      MetricsServer(const Registry &registry, logger::LoggerPtr log);
+
+      ~MetricsServer();
+
+      /**
+       * Start listening on the given address
+       * @param ip - ip address to listen on
+       * @param port - port to listen on, 0 selects a free port
+       * @return Result with the bound port or error message
+       */
+      expected::Result<uint16_t, std::string> run(const std::string &ip,
+                                                  uint16_t port);
+
+     private:
+      /// Wait for the next connection
+      void accept();
+
+      /// Read the request from the connection and write the metrics to it
+      void respond(std::shared_ptr<boost::asio::ip::tcp::socket> socket);
+
+      const Registry &registry_;
+      logger::LoggerPtr log_;
+
+      boost::asio::io_service io_service_;
+      boost::asio::ip::tcp::acceptor acceptor_;
+      std::thread thread_;
+    };
+
+  }  // namespace metrics
+}  // namespace iroha
+
+#endif  // IROHA_METRICS_SERVER_HPP
@@ -0,0 +1,58 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "tracing/trace_dumper.hpp"
+
+#include <ciso646>
+
+#include "logger/logger.hpp"
+
+namespace iroha {
+  namespace tracing {
+
+    TraceDumper::TraceDumper(const Tracer &tracer,
+                             std::string path,
+                             std::chrono::milliseconds interval,
+                             logger::LoggerPtr log)
+        : tracer_(tracer),
+          path_(std::move(path)),
+          interval_(interval),
+          log_(std::move(log)),
+          stop_(false) {
+      if (interval_.count() <= 0) {
+        return;
+      }
+      thread_ = std::thread([this] {
+        std::unique_lock<std::mutex> lock(mutex_);
+        while (not stop_cv_.wait_for(
+            lock, interval_, [this] { return stop_; })) {
+          lock.unlock();
+          dump();
+          lock.lock();
+        }
+      });
+    }
+
+    TraceDumper::~TraceDumper() {
+      if (thread_.joinable()) {
+        {
+          std::lock_guard<std::mutex> lock(mutex_);
+          stop_ = true;
+        }
+        stop_cv_.notify_all();
+        thread_.join();
+      }
+      dump();
+    }
+
+    void TraceDumper::dump() {
+      auto result = tracer_.dump(path_);
+      if (auto error = boost::get<expected::Error<std::string>>(&result)) {
+        log_->error("Failed to save trace: {}", error->error);
+      }
+    }
+
+  }  // namespace tracing
+}  // namespace iroha
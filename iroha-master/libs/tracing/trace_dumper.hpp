@@ -0,0 +1,61 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_TRACE_DUMPER_HPP
+#define IROHA_TRACE_DUMPER_HPP
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include "logger/logger_fwd.hpp"
+#include "tracing/tracer.hpp"
+
+namespace iroha {
+  namespace tracing {
+
+    /**
+     * Writes the events of a tracer to a file periodically in a background
+     * thread, and once more when destroyed. The trace of a running node is
+     * therefore available, and a crash loses at most the events of the last
+     * interval.
+     */
+    class TraceDumper {
+     public:
+      /**
+       * @param tracer - the tracer to dump
+       * @param path - the file to write
+       * @param interval - period of the dumps, 0 disables the periodic dumps
+       * @param log - logger
+       */
+      TraceDumper(const Tracer &tracer,
+                  std::string path,
+                  std::chrono::milliseconds interval,
+                  logger::LoggerPtr log);
+
+      /// Stops the periodic dumps and writes the final one
+      ~TraceDumper();
+
+     private:
+      /// Write the trace and log the failure
+      void dump();
+
+      const Tracer &tracer_;
+      const std::string path_;
+      const std::chrono::milliseconds interval_;
+      logger::LoggerPtr log_;
+
+      bool stop_;
+      std::mutex mutex_;
+      std::condition_variable stop_cv_;
+      std::thread thread_;
+    };
+
+  }  // namespace tracing
+}  // namespace iroha
+
+#endif  // IROHA_TRACE_DUMPER_HPP
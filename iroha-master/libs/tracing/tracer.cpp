@@ -0,0 +1,117 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "tracing/tracer.hpp"
+
+#include <ciso646>
+#include <cstdio>
+#include <fstream>
+
+namespace {
+  /// Quote the CSV field, since ids and contexts contain commas
+  std::string quote(const std::string &field) {
+    std::string quoted = "\"";
+    for (auto c : field) {
+      if (c == '"') {
+        quoted += '"';
+      }
+      quoted += c;
+    }
+    return quoted + "\"";
+  }
+}  // namespace
+
+namespace iroha {
+  namespace tracing {
+
+    Tracer::Tracer() : enabled_(false), capacity_(0), next_(0) {}
+
+    void Tracer::enable(size_t capacity) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      capacity_ = capacity;
+      buffer_.clear();
+      buffer_.reserve(capacity_);
+      next_ = 0;
+      enabled_.store(capacity_ > 0, std::memory_order_relaxed);
+    }
+
+    bool Tracer::enabled() const {
+      return enabled_.load(std::memory_order_relaxed);
+    }
+
+    void Tracer::record(const char *stage,
+                        std::string id,
+                        std::string context) {
+      if (not enabled()) {
+        return;
+      }
+      TraceEvent event{std::chrono::system_clock::now(),
+                       stage,
+                       std::move(id),
+                       std::move(context)};
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (capacity_ == 0) {
+        return;
+      }
+      if (buffer_.size() < capacity_) {
+        buffer_.push_back(std::move(event));
+      } else {
+        buffer_[next_] = std::move(event);
+      }
+      next_ = (next_ + 1) % capacity_;
+    }
+
+    std::vector<TraceEvent> Tracer::events() const {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (buffer_.size() < capacity_) {
+        return buffer_;
+      }
+      std::vector<TraceEvent> events;
+      events.reserve(buffer_.size());
+      events.insert(events.end(), buffer_.begin() + next_, buffer_.end());
+      events.insert(events.end(), buffer_.begin(), buffer_.begin() + next_);
+      return events;
+    }
+
+    expected::Result<void, std::string> Tracer::dump(
+        const std::string &path) const {
+      // the trace is replaced at once, so that a crash during a dump does
+      // not leave a truncated file
+      const auto temporary_path = path + ".tmp";
+      {
+        std::ofstream file(temporary_path);
+        if (not file) {
+          return expected::makeError("Failed to open trace file "
+                                     + temporary_path);
+        }
+        file << "time_us,stage,id,context\n";
+        for (const auto &event : events()) {
+          file << std::chrono::duration_cast<std::chrono::microseconds>(
+                      event.time.time_since_epoch())
+                      .count()
+               << "," << event.stage << "," << quote(event.id) << ","
+               << quote(event.context) << "\n";
+        }
+        file.close();
+        if (not file) {
+          std::remove(temporary_path.c_str());
+          return expected::makeError("Failed to write trace file "
+                                     + temporary_path);
+        }
+      }
+      if (std::rename(temporary_path.c_str(), path.c_str()) != 0) {
+        std::remove(temporary_path.c_str());
+        return expected::makeError("Failed to replace trace file " + path);
+      }
+      return {};
+    }
+
+    Tracer &defaultTracer() {
+      static Tracer tracer;
+      return tracer;
+    }
+
+  }  // namespace tracing
+}  // namespace iroha
@@ -0,0 +1,123 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_TRACER_HPP
+#define IROHA_TRACER_HPP
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "common/result.hpp"
+
+namespace iroha {
+  namespace tracing {
+
+    /// A stage transition of a transaction or a round
+    struct TraceEvent {
+      std::chrono::system_clock::time_point time;
+      /// Name of the stage, a string literal
+      const char *stage;
+      /// Transaction hash or round
+      std::string id;
+      /// Additional data, e.g. the round of a transaction
+      std::string context;
+    };
+
+    /**
+     * Records stage transitions into a bounded in-memory buffer, the oldest
+     * events are overwritten. Disabled by default, in which case recording
+     * costs a single atomic load.
+     */
+    class Tracer {
+     public:
+      Tracer();
+
+      /**
+       * Start recording
+       * @param capacity - maximum number of kept events
+       */
+      void enable(size_t capacity);
+
+      bool enabled() const;
+
+      /**
+       * Record the event if tracing is enabled
+       * @param stage - name of the stage, a string literal
+       * @param id - transaction hash or round
+       * @param context - additional data
+       */
+      void record(const char *stage,
+                  std::string id,
+                  std::string context = std::string{});
+
+      /// @return kept events, the oldest first
+      std::vector<TraceEvent> events() const;
+
+      /**
+       * Write the kept events to a CSV file with columns time in
+       * microseconds since epoch, stage, id and context. The file is written
+       * next to the target and then renamed, replacing the previous dump
+       * @param path - the file to write
+       * @return error message on failure
+       */
+      expected::Result<void, std::string> dump(const std::string &path) const;
+
+     private:
+      std::atomic<bool> enabled_;
+
+      mutable std::mutex mutex_;
+      std::vector<TraceEvent> buffer_;
+      size_t capacity_;
+      /// Position of the next event in the buffer
+      size_t next_;
+    };
+
+    /// @return the tracer of the process
+    Tracer &defaultTracer();
+
+    /**
+     * Record the stage of each transaction if tracing is enabled
+     * @tparam Transactions - range of transactions
+     * @param stage - name of the stage, a string literal
+     * @param transactions - the transactions
+     * @param context - additional data
+     */
+    template <typename Transactions>
+    void traceTransactions(const char *stage,
+                           const Transactions &transactions,
+                           const std::string &context = std::string{}) {
+      auto &tracer = defaultTracer();
+      if (not tracer.enabled()) {
+        return;
+      }
+      for (const auto &transaction : transactions) {
+        tracer.record(stage, transaction.hash().hex(), context);
+      }
+    }
+
+    /**
+     * Record the stage of the object, e.g. a round, if tracing is enabled
+     * @tparam T - type with toString method
+     * @param stage - name of the stage, a string literal
+     * @param object - the object, identified by its string representation
+     * @param context - additional data
+     */
+    template <typename T>
+    void traceObject(const char *stage,
+                     const T &object,
+                     const std::string &context = std::string{}) {
+      auto &tracer = defaultTracer();
+      if (tracer.enabled()) {
+        tracer.record(stage, object.toString(), context);
+      }
+    }
+
+  }  // namespace tracing
+}  // namespace iroha
+
+#endif  // IROHA_TRACER_HPP
@@ -22,6 +22,14 @@ namespace shared_model {
       explicit Block(const TransportType &ref);
       explicit Block(TransportType &&ref);
 
+      /**
+       * Borrow the message allocated on the arena instead of copying it, so
+       * that the block and its transactions live in the arena blocks
+       * @param arena - owner of the message, kept alive by the block
+       * @param ref - message to borrow
+       */
+      Block(std::shared_ptr<google::protobuf::Arena> arena, TransportType &ref);
+
       interface::types::TransactionsCollectionType transactions()
           const override;
 
@@ -10,6 +10,7 @@
 #include "backend/protobuf/transaction.hpp"
 #include "backend/protobuf/util.hpp"
 #include "common/byteutils.hpp"
+#include "utils/reference_holder.hpp"
 
 namespace shared_model {
   namespace proto {
@@ -17,11 +18,15 @@ namespace shared_model {
     struct Block::Impl {
       explicit Impl(TransportType &&ref) : proto_(std::move(ref)) {}
       explicit Impl(const TransportType &ref) : proto_(ref) {}
+      Impl(std::shared_ptr<google::protobuf::Arena> arena, TransportType &ref)
+          : arena_(std::move(arena)), proto_(ref) {}
       Impl(Impl &&o) noexcept = delete;
       Impl &operator=(Impl &&o) noexcept = delete;
 
-      TransportType proto_;
-      iroha::protocol::Block_v1::Payload &payload_{*proto_.mutable_payload()};
+      /// Owner of the borrowed message, if any
+      std::shared_ptr<google::protobuf::Arena> arena_;
+      detail::ReferenceHolder<TransportType> proto_;
+      iroha::protocol::Block_v1::Payload &payload_{*proto_->mutable_payload()};
 
       std::vector<proto::Transaction> transactions_{[this] {
         return std::vector<proto::Transaction>(
@@ -29,15 +34,15 @@ namespace shared_model {
             payload_.mutable_transactions()->end());
       }()};
 
-      interface::types::BlobType blob_{[this] { return makeBlob(proto_); }()};
+      interface::types::BlobType blob_{[this] { return makeBlob(*proto_); }()};
 
       interface::types::HashType prev_hash_{[this] {
         return interface::types::HashType(
-            crypto::Hash::fromHexString(proto_.payload().prev_block_hash()));
+            crypto::Hash::fromHexString(proto_->payload().prev_block_hash()));
       }()};
 
       SignatureSetType<proto::Signature> signatures_{[this] {
-        auto signatures = *proto_.mutable_signatures()
+        auto signatures = *proto_->mutable_signatures()
             | boost::adaptors::transformed(
                   [](auto &x) { return proto::Signature(x); });
         return SignatureSetType<proto::Signature>(signatures.begin(),
@@ -71,6 +76,11 @@ namespace shared_model {
       impl_ = std::make_unique<Block::Impl>(std::move(ref));
     }
 
+    Block::Block(std::shared_ptr<google::protobuf::Arena> arena,
+                 TransportType &ref) {
+      impl_ = std::make_unique<Block::Impl>(std::move(arena), ref);
+    }
+
     interface::types::TransactionsCollectionType Block::transactions() const {
       return impl_->transactions_;
     }
@@ -103,12 +113,12 @@ namespace shared_model {
         return false;
       }
 
-      auto sig = impl_->proto_.add_signatures();
+      auto sig = impl_->proto_->add_signatures();
       sig->set_signature(signed_blob.hex());
       sig->set_public_key(public_key.hex());
 
       impl_->signatures_ = [this] {
-        auto signatures = *impl_->proto_.mutable_signatures()
+        auto signatures = *impl_->proto_->mutable_signatures()
             | boost::adaptors::transformed(
                   [](auto &x) { return proto::Signature(x); });
         return SignatureSetType<proto::Signature>(signatures.begin(),
@@ -139,11 +149,11 @@ namespace shared_model {
     }
 
     const iroha::protocol::Block_v1 &Block::getTransport() const {
-      return impl_->proto_;
+      return *impl_->proto_;
     }
 
     Block::ModelType *Block::clone() const {
-      return new Block(impl_->proto_);
+      return new Block(*impl_->proto_);
     }
 
     Block::~Block() = default;
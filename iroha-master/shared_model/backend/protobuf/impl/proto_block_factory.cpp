@@ -29,7 +29,11 @@ ProtoBlockFactory::unsafeCreateBlock(
     interface::types::TimestampType created_time,
     const interface::types::TransactionsCollectionType &txs,
     const interface::types::HashCollectionType &rejected_hashes) {
-  iroha::protocol::Block_v1 block;
+  auto arena = std::make_shared<google::protobuf::Arena>();
+  auto *proto_block_container =
+      google::protobuf::Arena::CreateMessage<iroha::protocol::Block>(
+          arena.get());
+  auto &block = *proto_block_container->mutable_block_v1();
   auto *block_payload = block.mutable_payload();
   block_payload->set_height(height);
   block_payload->set_prev_block_hash(prev_hash.hex());
@@ -51,14 +55,11 @@ ProtoBlockFactory::unsafeCreateBlock(
                   (*next_hash) = hash.hex();
                 });
 
-  iroha::protocol::Block proto_block_container;
-  proto_block_container.set_allocated_block_v1(&block);
   auto proto_block_validation_result =
-      proto_validator_->validate(proto_block_container);
-  proto_block_container.release_block_v1();
+      proto_validator_->validate(*proto_block_container);
 
   auto model_proto_block =
-      std::make_unique<shared_model::proto::Block>(std::move(block));
+      std::make_unique<shared_model::proto::Block>(std::move(arena), block);
   auto interface_block_validation_result =
       interface_validator_->validate(*model_proto_block);
 
@@ -84,7 +85,24 @@ ProtoBlockFactory::createBlock(iroha::protocol::Block block) {
   }
 
   std::unique_ptr<shared_model::interface::Block> proto_block =
-      std::make_unique<Block>(std::move(block.block_v1()));
+      std::make_unique<Block>(std::move(*block.mutable_block_v1()));
+  if (auto errors = interface_validator_->validate(*proto_block)) {
+    return iroha::expected::makeError(errors.reason());
+  }
+
+  return iroha::expected::makeValue(std::move(proto_block));
+}
+
+iroha::expected::Result<std::unique_ptr<shared_model::interface::Block>,
+                        std::string>
+ProtoBlockFactory::createBlock(std::shared_ptr<google::protobuf::Arena> arena,
+                               iroha::protocol::Block &block) {
+  if (auto errors = proto_validator_->validate(block)) {
+    return iroha::expected::makeError(errors.reason());
+  }
+
+  std::unique_ptr<shared_model::interface::Block> proto_block =
+      std::make_unique<Block>(std::move(arena), *block.mutable_block_v1());
   if (auto errors = interface_validator_->validate(*proto_block)) {
     return iroha::expected::makeError(errors.reason());
   }
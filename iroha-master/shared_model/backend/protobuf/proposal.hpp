@@ -22,6 +22,15 @@ namespace shared_model {
       explicit Proposal(const TransportType &ref);
       explicit Proposal(TransportType &&ref);
 
+      /**
+       * Borrow the message allocated on the arena instead of copying it, so
+       * that the proposal and its transactions live in the arena blocks
+       * @param arena - owner of the message, kept alive by the proposal
+       * @param ref - message to borrow
+       */
+      Proposal(std::shared_ptr<google::protobuf::Arena> arena,
+               TransportType &ref);
+
       interface::types::TransactionsCollectionType transactions()
           const override;
 
@@ -42,6 +42,18 @@ namespace shared_model {
       iroha::expected::Result<std::unique_ptr<interface::Block>, std::string>
       createBlock(iroha::protocol::Block block);
 
+      /**
+       * Create block variant borrowing the proto block instead of copying it
+       *
+       * @param arena - owner of the proto block, kept alive by the block
+       * @param block - proto block allocated on the arena
+       * @return Pointer to block.
+       *         Error if block is invalid
+       */
+      iroha::expected::Result<std::unique_ptr<interface::Block>, std::string>
+      createBlock(std::shared_ptr<google::protobuf::Arena> arena,
+                  iroha::protocol::Block &block);
+
      private:
       std::unique_ptr<shared_model::validation::AbstractValidator<
           shared_model::interface::Block>>
@@ -32,8 +32,10 @@ namespace shared_model {
           interface::types::HeightType height,
           interface::types::TimestampType created_time,
           TransactionsCollectionType transactions) override {
-        return createProposal(
-            createProtoProposal(height, created_time, transactions));
+        auto arena = std::make_shared<google::protobuf::Arena>();
+        auto &proposal =
+            createProtoProposal(*arena, height, created_time, transactions);
+        return validate(std::make_unique<Proposal>(std::move(arena), proposal));
       }
 
       // TODO mboldyrev 13.02.2019 IR-323
@@ -42,8 +44,10 @@ namespace shared_model {
           interface::types::HeightType height,
           interface::types::TimestampType created_time,
           UnsafeTransactionsCollectionType transactions) override {
-        return std::make_unique<Proposal>(
-            createProtoProposal(height, created_time, transactions));
+        auto arena = std::make_shared<google::protobuf::Arena>();
+        auto &proposal =
+            createProtoProposal(*arena, height, created_time, transactions);
+        return std::make_unique<Proposal>(std::move(arena), proposal);
       }
 
       /**
@@ -55,11 +59,19 @@ namespace shared_model {
       }
 
      private:
-      iroha::protocol::Proposal createProtoProposal(
+      /**
+       * Create the protobuf proposal on the arena, so that the copies of the
+       * transactions are placed in a few arena blocks instead of thousands
+       * of separate heap allocations
+       * @return the proposal owned by the arena
+       */
+      iroha::protocol::Proposal &createProtoProposal(
+          google::protobuf::Arena &arena,
           interface::types::HeightType height,
           interface::types::TimestampType created_time,
           UnsafeTransactionsCollectionType transactions) {
-        iroha::protocol::Proposal proposal;
+        auto &proposal = *google::protobuf::Arena::CreateMessage<
+            iroha::protocol::Proposal>(&arena);
 
         proposal.set_height(height);
         proposal.set_created_time(created_time);
@@ -32,6 +32,12 @@ namespace integration_framework {
       logger::LoggerPtr log,
       const boost::optional<std::string> &dbname)
       : block_store_dir_(block_store_path),
+        block_store_options_([] {
+          iroha::ametsuchi::FlatFileOptions options;
+          // blocks of test ledgers do not have to survive a power loss
+          options.sync_interval = 0;
+          return options;
+        }()),
         working_dbname_(dbname.value_or(getRandomDbName())),
         listen_ip_(listen_ip),
         torii_port_(torii_port),
@@ -93,6 +99,7 @@ namespace integration_framework {
       const shared_model::crypto::Keypair &key_pair, size_t max_proposal_size) {
     instance_ = std::make_shared<TestIrohad>(
         block_store_dir_,
+        block_store_options_,
         std::make_unique<iroha::ametsuchi::PostgresOptions>(
             getPostgresCredsOrDefault(), working_dbname_, log_),
         listen_ip_,
@@ -101,10 +108,15 @@ namespace integration_framework {
         max_proposal_size,
         proposal_delay_,
         vote_delay_,
+        iroha::consensus::yac::VoteDissemination::kLeader,
         mst_expiration_time_,
         key_pair,
         max_rounds_delay_,
         stale_stream_max_rounds_,
+        0,
+        std::chrono::milliseconds::zero(),
+        iroha::ordering::ProposalBudget{},
+        iroha::torii::AdmissionLimits{},
         boost::none,
         irohad_log_manager_,
         log_,
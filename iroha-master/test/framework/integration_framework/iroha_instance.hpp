@@ -13,6 +13,7 @@
 #include <boost/optional.hpp>
 #include <boost/uuid/uuid_generators.hpp>
 #include <boost/uuid/uuid_io.hpp>
+#include "ametsuchi/impl/flat_file/flat_file_options.hpp"
 #include "ametsuchi/impl/postgres_options.hpp"
 #include "logger/logger_fwd.hpp"
 #include "logger/logger_manager_fwd.hpp"
@@ -76,6 +77,7 @@ namespace integration_framework {
 
     // config area
     const boost::optional<std::string> block_store_dir_;
+    const iroha::ametsuchi::FlatFileOptions block_store_options_;
     const std::string working_dbname_;
     const std::string listen_ip_;
     const size_t torii_port_;
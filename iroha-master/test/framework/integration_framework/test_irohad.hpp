@@ -17,6 +17,7 @@ namespace integration_framework {
   class TestIrohad : public Irohad {
    public:
     TestIrohad(const boost::optional<std::string> &block_store_dir,
+               iroha::ametsuchi::FlatFileOptions block_store_options,
                std::unique_ptr<iroha::ametsuchi::PostgresOptions> pg_opt,
                const std::string &listen_ip,
                size_t torii_port,
@@ -24,10 +25,15 @@ namespace integration_framework {
                size_t max_proposal_size,
                std::chrono::milliseconds proposal_delay,
                std::chrono::milliseconds vote_delay,
+               iroha::consensus::yac::VoteDissemination vote_dissemination,
                std::chrono::minutes mst_expiration_time,
                const shared_model::crypto::Keypair &keypair,
                std::chrono::milliseconds max_rounds_delay,
                size_t stale_stream_max_rounds,
+               size_t max_pending_batches,
+               std::chrono::milliseconds tx_ttl,
+               iroha::ordering::ProposalBudget proposal_budget,
+               iroha::torii::AdmissionLimits admission_limits,
                boost::optional<shared_model::interface::types::PeerList>
                    opt_alternative_peers,
                logger::LoggerManagerTreePtr irohad_log_manager,
@@ -35,6 +41,7 @@ namespace integration_framework {
                const boost::optional<iroha::GossipPropagationStrategyParams>
                    &opt_mst_gossip_params = boost::none)
         : Irohad(block_store_dir,
+                 std::move(block_store_options),
                  std::move(pg_opt),
                  listen_ip,
                  torii_port,
@@ -42,10 +49,15 @@ namespace integration_framework {
                  max_proposal_size,
                  proposal_delay,
                  vote_delay,
+                 vote_dissemination,
                  mst_expiration_time,
                  keypair,
                  max_rounds_delay,
                  stale_stream_max_rounds,
+                 max_pending_batches,
+                 tx_ttl,
+                 std::move(proposal_budget),
+                 admission_limits,
                  std::move(opt_alternative_peers),
                  std::move(irohad_log_manager),
                  opt_mst_gossip_params),
@@ -34,6 +34,9 @@ struct RequestProposalFixture : public fuzzing::OrderingServiceFixture {
   void init_with(size_t transaction_limit) {
     ordering_service_ = std::make_shared<OnDemandOrderingServiceImpl>(
         transaction_limit,
+        0,
+        std::chrono::milliseconds::zero(),
+        ProposalBudget{},
         std::move(proposal_factory_),
         std::move(persistent_cache_),
         logger::getDummyLoggerPtr());
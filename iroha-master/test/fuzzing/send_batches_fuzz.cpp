@@ -28,6 +28,9 @@ extern "C" int LLVMFuzzerTestOneInput(const uint8_t *data, std::size_t size) {
   auto cache = std::make_shared<iroha::ametsuchi::TxPresenceCacheImpl>(storage);
   ordering_service_ = std::make_shared<OnDemandOrderingServiceImpl>(
       data[0],
+      0,
+      std::chrono::milliseconds::zero(),
+      ProposalBudget{},
       std::move(proposal_factory),
       std::move(cache),
       logger::getDummyLoggerPtr());
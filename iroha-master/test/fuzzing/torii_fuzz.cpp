@@ -21,6 +21,7 @@
 #include "module/irohad/multi_sig_transactions/mst_mocks.hpp"
 #include "module/irohad/network/network_mocks.hpp"
 #include "synchronizer/synchronizer_common.hpp"
+#include "torii/impl/admission_control.hpp"
 #include "torii/impl/command_service_impl.hpp"
 #include "torii/impl/status_bus_impl.hpp"
 #include "torii/processor/transaction_processor_impl.hpp"
@@ -62,6 +63,8 @@ struct CommandFixture {
         .WillRepeatedly(Return(sync_event_notifier_.get_observable()));
     EXPECT_CALL(*pcs_, onVerifiedProposal())
         .WillRepeatedly(Return(vprop_notifier_.get_observable()));
+    EXPECT_CALL(*pcs_, onExpiredBatches())
+        .WillRepeatedly(Return(mst_notifier_.get_observable()));
 
     mst_processor_ =
         std::make_shared<iroha::MockMstProcessor>(logger::getDummyLoggerPtr());
@@ -134,6 +137,8 @@ struct CommandFixture {
             transaction_factory,
             batch_parser,
             transaction_batch_factory,
+            std::make_shared<iroha::torii::AdmissionControl>(
+                iroha::torii::AdmissionLimits{}, logger::getDummyLoggerPtr()),
             rxcpp::observable<>::iterate(consensus_gate_objects_),
             2,
             logger::getDummyLoggerPtr());
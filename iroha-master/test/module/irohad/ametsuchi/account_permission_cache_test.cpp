@@ -0,0 +1,142 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/account_permission_cache.hpp"
+
+#include <gtest/gtest.h>
+#include "cryptography/public_key.hpp"
+#include "module/shared_model/builders/protobuf/test_block_builder.hpp"
+#include "module/shared_model/builders/protobuf/test_transaction_builder.hpp"
+
+using namespace iroha::ametsuchi;
+using shared_model::interface::RolePermissionSet;
+using shared_model::interface::permissions::Role;
+
+class AccountPermissionCacheTest : public ::testing::Test {
+ public:
+  /// @return loader which counts its calls and returns the given permissions
+  AccountPermissionCache::LoaderType loader(
+      boost::optional<RolePermissionSet> permissions) {
+    return [this, permissions] {
+      ++loads_;
+      return permissions;
+    };
+  }
+
+  /// @return block with a single transaction made by the given builder
+  template <typename Builder>
+  std::shared_ptr<const shared_model::interface::Block> makeBlock(
+      Builder &&builder) {
+    return createBlock({builder.creatorAccountId(creator_).build()});
+  }
+
+ protected:
+  const std::string creator_ = "admin@test";
+  const std::string account_ = "user@test";
+  const RolePermissionSet permissions_{Role::kGetMyAccount};
+  size_t loads_ = 0;
+  AccountPermissionCache cache_;
+};
+
+/**
+ * @given empty cache
+ * @when permissions of an account are requested twice
+ * @then they are loaded once and returned both times
+ */
+TEST_F(AccountPermissionCacheTest, LoadsOnce) {
+  ASSERT_EQ(cache_.get(account_, loader(permissions_)), permissions_);
+  ASSERT_EQ(cache_.get(account_, loader(permissions_)), permissions_);
+  ASSERT_EQ(loads_, 1);
+}
+
+/**
+ * @given empty cache
+ * @when permissions of an account can not be loaded
+ * @then nothing is cached and next request loads them again
+ */
+TEST_F(AccountPermissionCacheTest, FailedLoadIsNotCached) {
+  ASSERT_FALSE(cache_.get(account_, loader(boost::none)));
+  ASSERT_EQ(cache_.get(account_, loader(permissions_)), permissions_);
+  ASSERT_EQ(loads_, 2);
+}
+
+/**
+ * @given cache with permissions of an account
+ * @when a block which appends a role to the account is committed
+ * @then permissions of the account are loaded again
+ */
+TEST_F(AccountPermissionCacheTest, AppendRoleInvalidates) {
+  cache_.get(account_, loader(permissions_));
+  cache_.invalidate(
+      *makeBlock(TestTransactionBuilder().appendRole(account_, "role")));
+
+  RolePermissionSet new_permissions{Role::kGetAllAccounts};
+  ASSERT_EQ(cache_.get(account_, loader(new_permissions)), new_permissions);
+  ASSERT_EQ(loads_, 2);
+}
+
+/**
+ * @given cache with permissions of two accounts
+ * @when a block which detaches a role from one of them is committed
+ * @then only permissions of that account are loaded again
+ */
+TEST_F(AccountPermissionCacheTest, DetachRoleInvalidatesOnlyTarget) {
+  cache_.get(account_, loader(permissions_));
+  cache_.get(creator_, loader(permissions_));
+  cache_.invalidate(
+      *makeBlock(TestTransactionBuilder().detachRole(account_, "role")));
+
+  cache_.get(account_, loader(permissions_));
+  cache_.get(creator_, loader(permissions_));
+  ASSERT_EQ(loads_, 3);
+}
+
+/**
+ * @given cache with empty permissions of a nonexistent account
+ * @when a block which creates the account is committed
+ * @then permissions of the account are loaded again
+ */
+TEST_F(AccountPermissionCacheTest, CreateAccountInvalidates) {
+  cache_.get(account_, loader(RolePermissionSet{}));
+  cache_.invalidate(*makeBlock(TestTransactionBuilder().createAccount(
+      "user",
+      "test",
+      shared_model::interface::types::PubkeyType(std::string(32, '1')))));
+
+  ASSERT_EQ(cache_.get(account_, loader(permissions_)), permissions_);
+  ASSERT_EQ(loads_, 2);
+}
+
+/**
+ * @given cache with permissions of an account
+ * @when a block which does not change roles is committed
+ * @then cached permissions are still used
+ */
+TEST_F(AccountPermissionCacheTest, UnrelatedBlockKeepsEntries) {
+  cache_.get(account_, loader(permissions_));
+  cache_.invalidate(
+      *makeBlock(TestTransactionBuilder().createRole("role", {})));
+
+  cache_.get(account_, loader(permissions_));
+  ASSERT_EQ(loads_, 1);
+}
+
+/**
+ * @given empty cache
+ * @when the cache is invalidated while permissions are being loaded
+ * @then the loaded value is returned but not cached
+ */
+TEST_F(AccountPermissionCacheTest, OutdatedLoadIsNotCached) {
+  ASSERT_EQ(cache_.get(account_,
+                       [this] {
+                         ++loads_;
+                         cache_.invalidateAll();
+                         return boost::make_optional(permissions_);
+                       }),
+            permissions_);
+
+  cache_.get(account_, loader(permissions_));
+  ASSERT_EQ(loads_, 2);
+}
@@ -0,0 +1,226 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/async_block_storage.hpp"
+
+#include <future>
+
+#include <gtest/gtest.h>
+#include "ametsuchi/impl/in_memory_block_storage.hpp"
+#include "framework/test_logger.hpp"
+#include "module/irohad/ametsuchi/mock_block_storage.hpp"
+#include "module/shared_model/interface_mocks.hpp"
+
+using namespace iroha::ametsuchi;
+using ::testing::_;
+using ::testing::InSequence;
+using ::testing::Invoke;
+using ::testing::NiceMock;
+using ::testing::Return;
+
+class AsyncBlockStorageTest : public ::testing::Test {
+ public:
+  /// @return block with the given height
+  static std::shared_ptr<const shared_model::interface::Block> makeBlock(
+      shared_model::interface::types::HeightType height) {
+    auto block = std::make_shared<NiceMock<MockBlock>>();
+    ON_CALL(*block, height()).WillByDefault(Return(height));
+    return block;
+  }
+
+  /// @return storage which writes blocks to the given one
+  static std::unique_ptr<AsyncBlockStorage> makeStorage(
+      std::unique_ptr<BlockStorage> storage) {
+    return std::make_unique<AsyncBlockStorage>(
+        std::move(storage),
+        AsyncBlockStorage::kDefaultMaxPendingBlocks,
+        getTestLogger("AsyncBlockStorage"));
+  }
+};
+
+/**
+ * @given async storage over in-memory storage
+ * @when several blocks are inserted and flushed
+ * @then all of them are written to the underlying storage
+ */
+TEST_F(AsyncBlockStorageTest, FlushWritesBlocks) {
+  auto in_memory = std::make_unique<InMemoryBlockStorage>();
+  auto &written = *in_memory;
+  auto storage = makeStorage(std::move(in_memory));
+
+  for (auto height = 1u; height <= 3; ++height) {
+    ASSERT_TRUE(storage->insert(makeBlock(height)));
+  }
+  ASSERT_TRUE(storage->flush());
+
+  ASSERT_EQ(3, written.size());
+  ASSERT_EQ(3, storage->size());
+  ASSERT_EQ(2, (*storage->fetch(2))->height());
+}
+
+/**
+ * @given async storage with a block inserted
+ * @when block with non-sequential height is inserted
+ * @then insertion fails
+ */
+TEST_F(AsyncBlockStorageTest, NonSequentialInsert) {
+  auto storage = makeStorage(std::make_unique<InMemoryBlockStorage>());
+
+  ASSERT_TRUE(storage->insert(makeBlock(1)));
+  ASSERT_FALSE(storage->insert(makeBlock(3)));
+  ASSERT_FALSE(storage->insert(makeBlock(1)));
+  ASSERT_TRUE(storage->insert(makeBlock(2)));
+}
+
+/**
+ * @given underlying storage with blocks
+ * @when async storage over it inserts a block
+ * @then only the block next to the stored ones is inserted
+ */
+TEST_F(AsyncBlockStorageTest, InsertContinuesStoredBlocks) {
+  auto in_memory = std::make_unique<InMemoryBlockStorage>();
+  ASSERT_TRUE(in_memory->insert(makeBlock(1)));
+  ASSERT_TRUE(in_memory->insert(makeBlock(2)));
+  auto storage = makeStorage(std::move(in_memory));
+
+  ASSERT_FALSE(storage->insert(makeBlock(5)));
+  ASSERT_TRUE(storage->insert(makeBlock(3)));
+  ASSERT_TRUE(storage->flush());
+  ASSERT_EQ(3, storage->size());
+}
+
+/**
+ * @given async storage which underlying storage did not write a block yet
+ * @when the block is read
+ * @then it is served from memory
+ */
+TEST_F(AsyncBlockStorageTest, PendingBlockIsServed) {
+  auto mock = std::make_unique<NiceMock<MockBlockStorage>>();
+  std::promise<void> write_allowed;
+  auto write_allowed_future = write_allowed.get_future().share();
+  ON_CALL(*mock, insert(_)).WillByDefault(Invoke([write_allowed_future](auto) {
+    write_allowed_future.wait();
+    return true;
+  }));
+  auto storage = makeStorage(std::move(mock));
+
+  auto block = makeBlock(1);
+  ASSERT_TRUE(storage->insert(block));
+
+  ASSERT_EQ(1, storage->size());
+  ASSERT_EQ(block, *storage->fetch(1));
+  size_t visited = 0;
+  storage->forEach([&visited](const auto &) { ++visited; });
+  ASSERT_EQ(1, visited);
+  ASSERT_TRUE(storage->forRange(1, 1, [&block](auto fetched) {
+    EXPECT_EQ(block, fetched);
+    return true;
+  }));
+
+  write_allowed.set_value();
+  ASSERT_TRUE(storage->flush());
+}
+
+/**
+ * @given async storage which underlying storage fails to write a block once
+ * @when the block is inserted
+ * @then it is written on the next attempt
+ */
+TEST_F(AsyncBlockStorageTest, FailedWriteIsRetried) {
+  auto mock = std::make_unique<NiceMock<MockBlockStorage>>();
+  {
+    InSequence seq;
+    EXPECT_CALL(*mock, insert(_)).WillOnce(Return(false));
+    EXPECT_CALL(*mock, insert(_)).WillOnce(Return(true));
+  }
+  auto storage = makeStorage(std::move(mock));
+
+  ASSERT_TRUE(storage->insert(makeBlock(1)));
+  // flush returns false when it observes the failed attempt
+  while (not storage->flush()) {
+  }
+  ASSERT_EQ(1, storage->size());
+}
+
+/**
+ * @given async storage with written blocks
+ * @when it is cleared
+ * @then both the storage and the underlying one are empty
+ */
+TEST_F(AsyncBlockStorageTest, Clear) {
+  auto in_memory = std::make_unique<InMemoryBlockStorage>();
+  auto &written = *in_memory;
+  auto storage = makeStorage(std::move(in_memory));
+
+  ASSERT_TRUE(storage->insert(makeBlock(1)));
+  storage->clear();
+
+  ASSERT_EQ(0, storage->size());
+  ASSERT_EQ(0, written.size());
+  ASSERT_FALSE(storage->fetch(1));
+  ASSERT_TRUE(storage->insert(makeBlock(1)));
+}
+
+/**
+ * @given async storage which underlying storage always fails to write
+ * @when a block is inserted and the writes fail kMaxFailedWrites times
+ * @then the storage stops writing and the next insert fails
+ */
+TEST_F(AsyncBlockStorageTest, WritesStopAfterFailures) {
+  auto mock = std::make_unique<NiceMock<MockBlockStorage>>();
+  EXPECT_CALL(*mock, insert(_))
+      .Times(AsyncBlockStorage::kMaxFailedWrites)
+      .WillRepeatedly(Return(false));
+  auto storage = makeStorage(std::move(mock));
+
+  ASSERT_TRUE(storage->insert(makeBlock(1)));
+  // each failed flush observes at least one failed write
+  for (size_t i = 0; i < AsyncBlockStorage::kMaxFailedWrites; ++i) {
+    ASSERT_FALSE(storage->flush());
+  }
+
+  ASSERT_FALSE(storage->insert(makeBlock(2)));
+  ASSERT_FALSE(storage->flush());
+}
+
+/**
+ * @given async storage with written blocks
+ * @when forRange is called and its function blocks on the first block
+ * @then blocks are inserted and written meanwhile, and the range is read
+ * completely after the function is released
+ */
+TEST_F(AsyncBlockStorageTest, SlowReaderDoesNotBlockWrites) {
+  auto storage = makeStorage(std::make_unique<InMemoryBlockStorage>());
+  const auto stored = AsyncBlockStorage::kReadBatchSize + 1;
+  for (auto height = 1u; height <= stored; ++height) {
+    ASSERT_TRUE(storage->insert(makeBlock(height)));
+  }
+  ASSERT_TRUE(storage->flush());
+
+  std::promise<void> started, release;
+  auto released = release.get_future().share();
+  auto reader = std::async(std::launch::async, [&] {
+    size_t visited = 0;
+    auto read = storage->forRange(1, stored, [&](const auto &) {
+      if (visited++ == 0) {
+        started.set_value();
+        released.wait();
+      }
+      return true;
+    });
+    return read ? visited : 0;
+  });
+
+  started.get_future().wait();
+  const auto inserted = AsyncBlockStorage::kDefaultMaxPendingBlocks * 2;
+  for (auto height = stored + 1; height <= stored + inserted; ++height) {
+    ASSERT_TRUE(storage->insert(makeBlock(height)));
+  }
+  ASSERT_TRUE(storage->flush());
+  release.set_value();
+
+  ASSERT_EQ(stored, reader.get());
+  ASSERT_EQ(stored + inserted, storage->size());
+}
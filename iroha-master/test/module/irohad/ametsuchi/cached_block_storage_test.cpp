@@ -0,0 +1,107 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/cached_block_storage.hpp"
+
+#include <gtest/gtest.h>
+#include "module/irohad/ametsuchi/mock_block_storage.hpp"
+#include "module/shared_model/interface_mocks.hpp"
+
+using namespace iroha::ametsuchi;
+using ::testing::_;
+using ::testing::Invoke;
+using ::testing::NiceMock;
+using ::testing::Return;
+
+class CachedBlockStorageTest : public ::testing::Test {
+ public:
+  /// @return block with the given height
+  static std::shared_ptr<const shared_model::interface::Block> makeBlock(
+      shared_model::interface::types::HeightType height) {
+    auto block = std::make_shared<NiceMock<MockBlock>>();
+    ON_CALL(*block, height()).WillByDefault(Return(height));
+    return block;
+  }
+
+ protected:
+  void SetUp() override {
+    ON_CALL(*mock_storage_, insert(_)).WillByDefault(Return(true));
+  }
+
+  std::shared_ptr<MockBlockStorage> mock_storage_ =
+      std::make_shared<NiceMock<MockBlockStorage>>();
+  CachedBlockStorage storage_{mock_storage_, 2};
+};
+
+/**
+ * @given cached storage
+ * @when a block is fetched twice
+ * @then it is read from the underlying storage once
+ */
+TEST_F(CachedBlockStorageTest, FetchedBlockIsCached) {
+  auto block = makeBlock(1);
+  EXPECT_CALL(*mock_storage_, fetch(1))
+      .WillOnce(Return(boost::make_optional(block)));
+
+  ASSERT_EQ(block, *storage_.fetch(1));
+  ASSERT_EQ(block, *storage_.fetch(1));
+}
+
+/**
+ * @given cached storage with capacity 2
+ * @when 3 blocks are inserted
+ * @then the 2 latest are fetched from memory and the first one is read from
+ * the underlying storage
+ */
+TEST_F(CachedBlockStorageTest, LeastRecentlyUsedIsEvicted) {
+  for (auto height = 1u; height <= 3; ++height) {
+    ASSERT_TRUE(storage_.insert(makeBlock(height)));
+  }
+
+  EXPECT_CALL(*mock_storage_, fetch(1)).WillOnce(Return(boost::none));
+  EXPECT_CALL(*mock_storage_, fetch(2)).Times(0);
+  EXPECT_CALL(*mock_storage_, fetch(3)).Times(0);
+  ASSERT_TRUE(storage_.fetch(2));
+  ASSERT_TRUE(storage_.fetch(3));
+  ASSERT_FALSE(storage_.fetch(1));
+}
+
+/**
+ * @given cached storage with blocks 2 and 3 cached
+ * @when blocks from 1 to 3 are iterated
+ * @then only block 1 is read from the underlying storage
+ */
+TEST_F(CachedBlockStorageTest, RangeUsesCachedBlocks) {
+  ASSERT_TRUE(storage_.insert(makeBlock(2)));
+  ASSERT_TRUE(storage_.insert(makeBlock(3)));
+  EXPECT_CALL(*mock_storage_, forRange(1, 1, _))
+      .WillOnce(Invoke([](auto, auto, auto function) {
+        function(makeBlock(1));
+        return true;
+      }));
+
+  std::vector<shared_model::interface::types::HeightType> heights;
+  ASSERT_TRUE(storage_.forRange(1, 3, [&heights](auto block) {
+    heights.push_back(block->height());
+    return true;
+  }));
+  ASSERT_EQ(
+      (std::vector<shared_model::interface::types::HeightType>{1, 2, 3}),
+      heights);
+}
+
+/**
+ * @given cached storage with a block
+ * @when the storage is cleared
+ * @then the block is not returned from memory
+ */
+TEST_F(CachedBlockStorageTest, ClearDropsCache) {
+  ASSERT_TRUE(storage_.insert(makeBlock(1)));
+  EXPECT_CALL(*mock_storage_, clear());
+  storage_.clear();
+
+  EXPECT_CALL(*mock_storage_, fetch(1)).WillOnce(Return(boost::none));
+  ASSERT_FALSE(storage_.fetch(1));
+}
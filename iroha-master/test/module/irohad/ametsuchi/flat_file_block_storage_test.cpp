@@ -178,3 +178,50 @@ TEST_F(FlatFileBlockStorageTest, ForEach) {
 
   ASSERT_EQ(1, count);
 }
+
+/**
+ * @given initialized block storage, blocks from height_ to
+ * height_+kPrefetchBlocks+1 inserted except the block with height_+1
+ * @when forRange is called for the whole range and then for the blocks after
+ * the missing one
+ * @then the first call visits only block with height_ and fails, the second
+ * one visits all the blocks after the missing one
+ */
+TEST_F(FlatFileBlockStorageTest, ForRangeMissingBlock) {
+  auto block_storage =
+      FlatFileBlockStorageFactory(path_provider_, converter_, log_manager_)
+          .create();
+  const auto to = height_ + FlatFileBlockStorage::kPrefetchBlocks + 1;
+  for (auto height = height_; height <= to; ++height) {
+    if (height == height_ + 1) {
+      continue;
+    }
+    auto block = std::make_shared<NiceMock<MockBlock>>();
+    ON_CALL(*block, height()).WillByDefault(Return(height));
+    ASSERT_TRUE(block_storage->insert(block));
+  }
+
+  ON_CALL(*converter_, deserialize(_))
+      .WillByDefault(Invoke([](const shared_model::interface::types::JsonType &)
+                                -> iroha::expected::Result<
+                                    std::unique_ptr<
+                                        shared_model::interface::Block>,
+                                    std::string> {
+        return iroha::expected::makeValue<
+            std::unique_ptr<shared_model::interface::Block>>(
+            std::make_unique<MockBlock>());
+      }));
+
+  size_t count = 0;
+  auto counter = [&count](const auto &) {
+    ++count;
+    return true;
+  };
+
+  ASSERT_FALSE(block_storage->forRange(height_, to, counter));
+  ASSERT_EQ(1, count);
+
+  count = 0;
+  ASSERT_TRUE(block_storage->forRange(height_ + 2, to, counter));
+  ASSERT_EQ(to - height_ - 1, count);
+}
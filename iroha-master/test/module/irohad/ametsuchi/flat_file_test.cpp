@@ -259,3 +259,210 @@ TEST_F(BlStore_Test, RemoveAndCreateNew) {
   ASSERT_TRUE(bl_store->get(7));
   ASSERT_FALSE(bl_store->get(1));
 }
+
+/**
+ * @given initialized FlatFile storage with 3 blocks
+ * @when the file of the last block is truncated and new storage is created on
+ * the same directory
+ * @then the truncated file is removed and other blocks are available
+ */
+TEST_F(BlStore_Test, TornFileIsRemoved) {
+  {
+    auto store = FlatFile::create(block_store_path, flat_file_log_);
+    ASSERT_TRUE(store);
+    auto bl_store = std::move(*store);
+    bl_store->add(1, block);
+    bl_store->add(2, block);
+    bl_store->add(3, block);
+  }
+
+  auto file_name = fs::path(block_store_path) / FlatFile::id_to_name(3);
+  fs::resize_file(file_name, fs::file_size(file_name) / 2);
+
+  auto store = FlatFile::create(block_store_path, flat_file_log_);
+  ASSERT_TRUE(store);
+  auto bl_store = std::move(*store);
+  ASSERT_EQ(2, bl_store->last_id());
+  ASSERT_FALSE(fs::exists(file_name));
+  ASSERT_EQ(block, *bl_store->get(2));
+}
+
+/**
+ * @given initialized FlatFile storage with a block
+ * @when contents of the block file are changed
+ * @then get() fails
+ */
+TEST_F(BlStore_Test, CorruptedFileIsNotRead) {
+  auto store = FlatFile::create(block_store_path, flat_file_log_);
+  ASSERT_TRUE(store);
+  auto bl_store = std::move(*store);
+  bl_store->add(1, block);
+
+  auto file_name = fs::path(block_store_path) / FlatFile::id_to_name(1);
+  fs::fstream file(file_name,
+                   std::ios::in | std::ios::out | std::ios::binary);
+  file.seekp(block.size() / 2);
+  file.put(6);
+  file.close();
+
+  ASSERT_FALSE(bl_store->get(1));
+}
+
+/**
+ * @given directory with a file without checksum, written by previous versions
+ * @when storage is created on the directory
+ * @then the file is available as is
+ */
+TEST_F(BlStore_Test, FileWithoutChecksumIsRead) {
+  const auto file_name = fs::path(block_store_path) / FlatFile::id_to_name(1);
+  fs::ofstream file(file_name, std::ios::binary);
+  file.write(reinterpret_cast<const char *>(block.data()), block.size());
+  file.close();
+
+  auto store = FlatFile::create(block_store_path, flat_file_log_);
+  ASSERT_TRUE(store);
+  auto bl_store = std::move(*store);
+  ASSERT_EQ(1, bl_store->last_id());
+  ASSERT_EQ(block, *bl_store->get(1));
+}
+
+/**
+ * @given storage with group syncs and several written blocks
+ * @when the storage is destroyed
+ * @then all the blocks are available in new storage
+ */
+TEST_F(BlStore_Test, GroupSync) {
+  FlatFileOptions options;
+  options.sync_interval = 2;
+  {
+    auto store = FlatFile::create(block_store_path, flat_file_log_, options);
+    ASSERT_TRUE(store);
+    auto bl_store = std::move(*store);
+    bl_store->add(1, block);
+    bl_store->add(2, block);
+    bl_store->add(3, block);
+  }
+
+  auto store = FlatFile::create(block_store_path, flat_file_log_, options);
+  ASSERT_TRUE(store);
+  auto bl_store = std::move(*store);
+  ASSERT_EQ(3, bl_store->blockIdentifiers().size());
+  ASSERT_EQ(block, *bl_store->get(3));
+}
+
+/**
+ * @given storage which compresses files by 2 and keeps 1 latest file
+ * @when 4 files are added and the storage is created again
+ * @then the 2 oldest files are replaced by a segment in the cold storage dir
+ * and all the files are available in both storages
+ */
+TEST_F(BlStore_Test, OldFilesAreCompressed) {
+  const auto cold_path = block_store_path + "_cold";
+  FlatFileOptions options;
+  options.segment_size = 2;
+  options.hot_files = 1;
+  options.cold_path = cold_path;
+  {
+    auto store = FlatFile::create(block_store_path, flat_file_log_, options);
+    ASSERT_TRUE(store);
+    auto bl_store = std::move(*store);
+    for (auto id = 1u; id <= 4; ++id) {
+      ASSERT_TRUE(bl_store->add(id, block));
+    }
+    bl_store->waitCompression();
+
+    ASSERT_FALSE(
+        fs::exists(fs::path(block_store_path) / FlatFile::id_to_name(1)));
+    ASSERT_TRUE(fs::exists(fs::path(cold_path)
+                           / (FlatFile::id_to_name(1) + ".segment")));
+    ASSERT_LT(fs::file_size(fs::path(cold_path)
+                            / (FlatFile::id_to_name(1) + ".segment")),
+              block.size());
+    ASSERT_EQ(4, bl_store->blockIdentifiers().size());
+    ASSERT_EQ(block, *bl_store->get(1));
+    ASSERT_FALSE(bl_store->add(2, block));
+  }
+
+  auto store = FlatFile::create(block_store_path, flat_file_log_, options);
+  ASSERT_TRUE(store);
+  auto bl_store = std::move(*store);
+  ASSERT_EQ(4, bl_store->blockIdentifiers().size());
+  for (auto id = 1u; id <= 4; ++id) {
+    ASSERT_EQ(block, *bl_store->get(id));
+  }
+  fs::remove_all(cold_path);
+}
+
+/**
+ * @given 4 files written by storage without compression
+ * @when storage which compresses files by 2 and keeps 1 latest file is created
+ * in the same dir
+ * @then the 2 oldest files are replaced by a segment and all the files are
+ * available
+ */
+TEST_F(BlStore_Test, OldFilesAreCompressedAfterRestart) {
+  {
+    auto store = FlatFile::create(block_store_path, flat_file_log_);
+    ASSERT_TRUE(store);
+    auto bl_store = std::move(*store);
+    for (auto id = 1u; id <= 4; ++id) {
+      ASSERT_TRUE(bl_store->add(id, block));
+    }
+  }
+
+  FlatFileOptions options;
+  options.segment_size = 2;
+  options.hot_files = 1;
+  auto store = FlatFile::create(block_store_path, flat_file_log_, options);
+  ASSERT_TRUE(store);
+  auto bl_store = std::move(*store);
+  bl_store->waitCompression();
+
+  ASSERT_FALSE(
+      fs::exists(fs::path(block_store_path) / FlatFile::id_to_name(1)));
+  ASSERT_TRUE(fs::exists(fs::path(block_store_path)
+                         / (FlatFile::id_to_name(1) + ".segment")));
+  ASSERT_EQ(4, bl_store->blockIdentifiers().size());
+  for (auto id = 1u; id <= 4; ++id) {
+    ASSERT_EQ(block, *bl_store->get(id));
+  }
+}
+
+/**
+ * @given storage which compresses files by 2 and keeps 1 latest file, and a
+ * directory in place of the first segment
+ * @when 4 files are added, the directory is removed and one more file is added
+ * @then the first segment is not written until the directory is removed, and
+ * then it is written along with the next one
+ */
+TEST_F(BlStore_Test, FailedSegmentIsRetried) {
+  FlatFileOptions options;
+  options.segment_size = 2;
+  options.hot_files = 1;
+  auto store = FlatFile::create(block_store_path, flat_file_log_, options);
+  ASSERT_TRUE(store);
+  auto bl_store = std::move(*store);
+  const auto first_segment = fs::path(block_store_path)
+      / (FlatFile::id_to_name(1) + ".segment");
+  fs::create_directories(first_segment / "file");
+
+  for (auto id = 1u; id <= 4; ++id) {
+    ASSERT_TRUE(bl_store->add(id, block));
+  }
+  bl_store->waitCompression();
+  ASSERT_TRUE(
+      fs::exists(fs::path(block_store_path) / FlatFile::id_to_name(1)));
+
+  fs::remove_all(first_segment);
+  ASSERT_TRUE(bl_store->add(5, block));
+  bl_store->waitCompression();
+
+  ASSERT_TRUE(fs::is_regular_file(first_segment));
+  ASSERT_TRUE(fs::exists(fs::path(block_store_path)
+                         / (FlatFile::id_to_name(3) + ".segment")));
+  ASSERT_FALSE(
+      fs::exists(fs::path(block_store_path) / FlatFile::id_to_name(1)));
+  for (auto id = 1u; id <= 5; ++id) {
+    ASSERT_EQ(block, *bl_store->get(id));
+  }
+}
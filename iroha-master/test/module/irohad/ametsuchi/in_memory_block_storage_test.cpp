@@ -120,3 +120,45 @@ TEST_F(InMemoryBlockStorageTest, ForEach) {
 
   ASSERT_EQ(1, count);
 }
+
+/**
+ * @given initialized block storage, single block with height_ inserted
+ * @when forRange is called for ranges with and without height_
+ * @then block with height_ is visited only for the range which contains it
+ */
+TEST_F(InMemoryBlockStorageTest, ForRange) {
+  ASSERT_TRUE(block_storage_.insert(block_));
+
+  size_t count = 0;
+  auto counter = [this, &count](const auto &block) {
+    ++count;
+    EXPECT_EQ(block_, block);
+    return true;
+  };
+
+  ASSERT_TRUE(block_storage_.forRange(height_ + 1, height_ + 2, counter));
+  ASSERT_EQ(0, count);
+
+  ASSERT_TRUE(block_storage_.forRange(height_, height_, counter));
+  ASSERT_EQ(1, count);
+}
+
+/**
+ * @given initialized block storage, blocks with height_ and height_+2 inserted
+ * @when forRange is called for the range from height_ to height_+2
+ * @then only block with height_ is visited and forRange fails
+ */
+TEST_F(InMemoryBlockStorageTest, ForRangeMissingBlock) {
+  auto another_block = std::make_shared<NiceMock<MockBlock>>();
+  ON_CALL(*another_block, height()).WillByDefault(Return(height_ + 2));
+  ASSERT_TRUE(block_storage_.insert(block_));
+  ASSERT_TRUE(block_storage_.insert(another_block));
+
+  size_t count = 0;
+  ASSERT_FALSE(
+      block_storage_.forRange(height_, height_ + 2, [&count](const auto &) {
+        ++count;
+        return true;
+      }));
+  ASSERT_EQ(1, count);
+}
@@ -24,6 +24,10 @@ namespace iroha {
       MOCK_CONST_METHOD0(size, size_t(void));
       MOCK_METHOD0(clear, void(void));
       MOCK_CONST_METHOD1(forEach, void(FunctionType));
+      MOCK_CONST_METHOD3(forRange,
+                         bool(shared_model::interface::types::HeightType,
+                              shared_model::interface::types::HeightType,
+                              RangeFunctionType));
     };
   }  // namespace ametsuchi
 }  // namespace iroha
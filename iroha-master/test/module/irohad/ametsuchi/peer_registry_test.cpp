@@ -0,0 +1,129 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/peer_registry.hpp"
+
+#include <gtest/gtest.h>
+#include "backend/plain/peer.hpp"
+#include "cryptography/public_key.hpp"
+#include "module/shared_model/builders/protobuf/test_block_builder.hpp"
+#include "module/shared_model/builders/protobuf/test_transaction_builder.hpp"
+
+using namespace iroha::ametsuchi;
+using shared_model::interface::types::PeerList;
+
+class PeerRegistryTest : public ::testing::Test {
+ public:
+  /// @return peer list with a single peer with the given address
+  static PeerList makePeers(const std::string &address) {
+    return {std::make_shared<shared_model::plain::Peer>(
+        address, shared_model::interface::types::PubkeyType(kPublicKey))};
+  }
+
+  /// @return block with a single transaction made by the given builder
+  template <typename Builder>
+  static std::shared_ptr<const shared_model::interface::Block> makeBlock(
+      Builder &&builder) {
+    return createBlock({builder.creatorAccountId("admin@test").build()});
+  }
+
+ protected:
+  static const std::string kPublicKey;
+
+  size_t loads_ = 0;
+  boost::optional<PeerList> stored_peers_ = makePeers("127.0.0.1:10001");
+  PeerRegistry registry_{[this] {
+    ++loads_;
+    return stored_peers_;
+  }};
+};
+
+const std::string PeerRegistryTest::kPublicKey(32, '1');
+
+/**
+ * @given empty registry
+ * @when peers are requested twice
+ * @then they are loaded once and the same snapshot is returned both times
+ */
+TEST_F(PeerRegistryTest, LoadsOnce) {
+  auto first = registry_.get();
+  ASSERT_TRUE(first);
+  ASSERT_EQ(first, registry_.get());
+  ASSERT_EQ(1, loads_);
+  ASSERT_EQ("127.0.0.1:10001", first->peers.at(0)->address());
+}
+
+/**
+ * @given empty registry
+ * @when peers can not be loaded
+ * @then nothing is returned and next request loads them again
+ */
+TEST_F(PeerRegistryTest, FailedLoadIsNotCached) {
+  stored_peers_ = boost::none;
+  ASSERT_FALSE(registry_.getLedgerPeers());
+
+  stored_peers_ = makePeers("127.0.0.1:10001");
+  ASSERT_TRUE(registry_.getLedgerPeers());
+  ASSERT_EQ(2, loads_);
+}
+
+/**
+ * @given registry with loaded peers
+ * @when peers are updated
+ * @then new peers are returned with a greater version without loading
+ */
+TEST_F(PeerRegistryTest, UpdateReplacesPeers) {
+  auto old_snapshot = registry_.get();
+  registry_.update(makePeers("127.0.0.1:10002"));
+
+  auto new_snapshot = registry_.get();
+  ASSERT_EQ("127.0.0.1:10002", new_snapshot->peers.at(0)->address());
+  ASSERT_GT(new_snapshot->version, old_snapshot->version);
+  ASSERT_EQ(1, loads_);
+}
+
+/**
+ * @given registry with loaded peers
+ * @when it is invalidated
+ * @then peers are loaded again on the next request
+ */
+TEST_F(PeerRegistryTest, InvalidateReloads) {
+  registry_.get();
+  registry_.invalidate();
+  registry_.get();
+  ASSERT_EQ(2, loads_);
+}
+
+/**
+ * @given empty registry
+ * @when peers are updated while they are being loaded
+ * @then the loaded peers are returned but not kept
+ */
+TEST_F(PeerRegistryTest, OutdatedLoadIsNotKept) {
+  PeerRegistry registry([this, &registry]() -> boost::optional<PeerList> {
+    ++loads_;
+    registry.update(makePeers("127.0.0.1:10002"));
+    return makePeers("127.0.0.1:10001");
+  });
+
+  ASSERT_EQ("127.0.0.1:10001", registry.get()->peers.at(0)->address());
+  ASSERT_EQ("127.0.0.1:10002", registry.get()->peers.at(0)->address());
+  ASSERT_EQ(1, loads_);
+}
+
+/**
+ * @given blocks with and without peer commands
+ * @when they are checked for peer changes
+ * @then only blocks with AddPeer or RemovePeer change peers
+ */
+TEST_F(PeerRegistryTest, ChangesPeers) {
+  ASSERT_TRUE(PeerRegistry::changesPeers(*makeBlock(
+      TestTransactionBuilder().addPeerRaw("127.0.0.1:10002", kPublicKey))));
+  ASSERT_TRUE(PeerRegistry::changesPeers(*makeBlock(
+      TestTransactionBuilder().removePeer(
+          shared_model::interface::types::PubkeyType(kPublicKey)))));
+  ASSERT_FALSE(PeerRegistry::changesPeers(
+      *makeBlock(TestTransactionBuilder().createRole("role", {}))));
+}
@@ -209,3 +209,91 @@ TEST_F(PostgresBlockStorageTest, ForEach) {
 
   ASSERT_EQ(2, count);
 }
+
+/**
+ * @given initialized block storage with more blocks than are read by a single
+ * query
+ * @when forRange is called for a range, which crosses the batch boundary
+ * @then blocks of the range are visited in ascending order
+ */
+TEST_F(PostgresBlockStorageTest, ForRange) {
+  const size_t blocks_number = PostgresBlockStorage::kFetchBatchSize + 3;
+  auto tx = TestTransactionBuilder().creatorAccountId(creator_).build();
+  std::vector<shared_model::proto::Transaction> txs;
+  txs.push_back(std::move(tx));
+  for (size_t i = 0; i < blocks_number; ++i) {
+    ASSERT_TRUE(block_storage_->insert(clone(
+        TestBlockBuilder().height(height_ + i).transactions(txs).build())));
+  }
+
+  auto from = height_ + 1;
+  auto to = height_ + blocks_number - 2;
+  auto expected_height = from;
+  ASSERT_TRUE(block_storage_->forRange(
+      from, to, [&expected_height](const auto &block) {
+        EXPECT_EQ(expected_height++, block->height());
+        return true;
+      }));
+
+  ASSERT_EQ(to + 1, expected_height);
+}
+
+/**
+ * @given initialized block storage, two blocks with height_ and height_+1 are
+ * inserted
+ * @when forRange is called and the function stops the iteration
+ * @then only the first block is visited
+ */
+TEST_F(PostgresBlockStorageTest, ForRangeStop) {
+  auto tx = TestTransactionBuilder().creatorAccountId(creator_).build();
+  std::vector<shared_model::proto::Transaction> txs;
+  txs.push_back(std::move(tx));
+  ASSERT_TRUE(block_storage_->insert(
+      clone(TestBlockBuilder().height(height_).transactions(txs).build())));
+  ASSERT_TRUE(block_storage_->insert(
+      clone(TestBlockBuilder().height(height_ + 1).transactions(txs).build())));
+
+  size_t count = 0;
+  ASSERT_TRUE(
+      block_storage_->forRange(height_, height_ + 1, [&count](const auto &) {
+        ++count;
+        return false;
+      }));
+
+  ASSERT_EQ(1, count);
+}
+
+/**
+ * @given table with a block stored as a hex string
+ * @when the table is created again
+ * @then it is migrated, the block is fetched and next blocks are inserted
+ */
+TEST_F(PostgresBlockStorageTest, MigrateHexTable) {
+  auto tx = TestTransactionBuilder().creatorAccountId(creator_).build();
+  std::vector<shared_model::proto::Transaction> txs;
+  txs.push_back(std::move(tx));
+  auto block = TestBlockBuilder().height(height_).transactions(txs).build();
+  auto another_block =
+      TestBlockBuilder().height(height_ + 1).transactions(txs).build();
+
+  const std::string table = "hex_blocks";
+  soci::session sql(*pool_wrapper_->connection_pool_);
+  sql << "CREATE TABLE " << table
+      << "(height bigint PRIMARY KEY, block_data text not null)";
+  auto height = block.height();
+  auto hex = block.blob().hex();
+  sql << "INSERT INTO " << table << " VALUES (:height, :block_data)",
+      soci::use(height), soci::use(hex);
+
+  framework::expected::assertResultValue(
+      PostgresBlockStorageFactory::createTable(sql, table));
+
+  PostgresBlockStorage storage(pool_wrapper_,
+                               block_factory_,
+                               table,
+                               getTestLogger("MigratedBlockStorage"));
+  ASSERT_EQ(1, storage.size());
+  ASSERT_EQ(block.blob(), (*storage.fetch(height))->blob());
+  ASSERT_TRUE(storage.insert(clone(another_block)));
+  ASSERT_EQ(2, storage.size());
+}
@@ -1497,6 +1497,27 @@ namespace iroha {
       ASSERT_EQ(kv.get(), "{\"id@domain\": {\"key\": \"value\"}}");
     }
 
+    /**
+     * @given account with a detail
+     * @when the detail is set again and another key is added
+     * @then the value of the detail is replaced and the other one is kept
+     */
+    TEST_F(SetAccountDetail, ValidOverwrite) {
+      CHECK_SUCCESSFUL_RESULT(
+          execute(*mock_command_factory->constructSetAccountDetail(
+              account_id, "key", "value")));
+      CHECK_SUCCESSFUL_RESULT(
+          execute(*mock_command_factory->constructSetAccountDetail(
+              account_id, "key2", "value")));
+      CHECK_SUCCESSFUL_RESULT(
+          execute(*mock_command_factory->constructSetAccountDetail(
+              account_id, "key", "value2")));
+      auto kv = sql_query->getAccountDetail(account_id);
+      ASSERT_TRUE(kv);
+      ASSERT_EQ(kv.get(),
+                R"({"id@domain": {"key": "value2", "key2": "value"}})");
+    }
+
     /**
      * @given command
      * @when trying to set kv when has grantable permission
@@ -25,6 +25,7 @@
 #include "backend/plain/peer.hpp"
 #include "backend/protobuf/proto_query_response_factory.hpp"
 #include "common/result.hpp"
+#include "cryptography/crypto_provider/crypto_defaults.hpp"
 #include "datetime/time.hpp"
 #include "framework/common_constants.hpp"
 #include "framework/result_fixture.hpp"
@@ -324,6 +325,34 @@ namespace iroha {
                      });
     }
 
+    /**
+     * @given signed blocks query with quotes in the creator account id
+     * @when its signatures are validated
+     * @then the validation fails
+     * @and the id is not executed as SQL, so the other queries still work
+     */
+    TEST_F(BlocksQueryExecutorTest, QuotedCreatorSignatures) {
+      addAllPerms();
+      auto blocks_query =
+          TestUnsignedBlocksQueryBuilder()
+              .creatorAccountId("id', ''); DROP TABLE account; --@domain")
+              .createdTime(iroha::time::now())
+              .queryCounter(1)
+              .build()
+              .signAndAddSignature(
+                  shared_model::crypto::DefaultCryptoAlgorithmType::
+                      generateKeypair())
+              .finish();
+      auto valid_query =
+          TestBlocksQueryBuilder().creatorAccountId(account_id).build();
+      ASSERT_TRUE(query_executor->createQueryExecutor(pending_txs_storage,
+                                                      query_response_factory)
+                  | [&](const auto &executor) {
+                      return not executor->validate(blocks_query, true)
+                          and executor->validate(valid_query, false);
+                    });
+    }
+
     class GetAccountExecutorTest : public QueryExecutorTest {
      public:
       void SetUp() override {
@@ -420,6 +449,23 @@ namespace iroha {
           std::move(result), kNoStatefulError);
     }
 
+    /**
+     * @given initialized storage, permission
+     * @when get account information about account with quotes in its id
+     * @then the id is passed to the prepared statement as a literal
+     * @and Return error
+     */
+    TEST_F(GetAccountExecutorTest, InvalidNoAccountQuotedId) {
+      addPerms({shared_model::interface::permissions::Role::kGetAllAccounts});
+      auto query = TestQueryBuilder()
+                       .creatorAccountId(account_id)
+                       .getAccount("some'); DROP TABLE account; --@domain")
+                       .build();
+      auto result = executeQuery(query);
+      checkStatefulError<shared_model::interface::NoAccountErrorResponse>(
+          std::move(result), kNoStatefulError);
+    }
+
     class GetSignatoriesExecutorTest : public QueryExecutorTest {
      public:
       void SetUp() override {
@@ -2072,6 +2118,58 @@ namespace iroha {
           });
     }
 
+    /**
+     * @given initialized storage, permission to his/her account, transactions
+     * missing in the transaction index
+     * @when get account transactions
+     * @then Return account transactions of user loaded from the blocks
+     */
+    TEST_F(GetAccountTransactionsExecutorTest, ValidMyAccountNotIndexed) {
+      addPerms({shared_model::interface::permissions::Role::kGetMyAccTxs});
+
+      commitBlocks();
+      *sql << "DELETE FROM tx_data_by_position WHERE height = 1";
+
+      auto query = TestQueryBuilder()
+                       .creatorAccountId(account_id)
+                       .getAccountTransactions(account_id, kTxPageSize)
+                       .build();
+      auto result = executeQuery(query);
+      checkSuccessfulResult<shared_model::interface::TransactionsPageResponse>(
+          std::move(result), [this](const auto &cast_resp) {
+            ASSERT_EQ(cast_resp.transactions().size(), 3);
+            EXPECT_EQ(cast_resp.transactions()[0].hash(), hash1);
+            EXPECT_EQ(cast_resp.transactions()[1].hash(), hash2);
+            for (const auto &tx : cast_resp.transactions()) {
+              EXPECT_EQ(account_id, tx.creatorAccountId()) << tx.toString();
+            }
+          });
+    }
+
+    /**
+     * @given initialized storage, permission to his/her account, a position of
+     * a transaction which is missing in both the transaction index and the
+     * block
+     * @when get account transactions
+     * @then Return error
+     */
+    TEST_F(GetAccountTransactionsExecutorTest, MissingTransaction) {
+      addPerms({shared_model::interface::permissions::Role::kGetMyAccTxs});
+
+      commitBlocks();
+      *sql << "INSERT INTO tx_position_by_creator(creator_id, height, index) "
+              "VALUES (:id, 1, 100)",
+          soci::use(account_id);
+
+      auto query = TestQueryBuilder()
+                       .creatorAccountId(account_id)
+                       .getAccountTransactions(account_id, kTxPageSize)
+                       .build();
+      auto result = executeQuery(query);
+      checkStatefulError<shared_model::interface::StatefulFailedErrorResponse>(
+          std::move(result), 1);
+    }
+
     /**
      * @given initialized storage, global permission
      * @when get account transactions of other user
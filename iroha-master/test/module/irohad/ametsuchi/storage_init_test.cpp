@@ -149,3 +149,74 @@ TEST_F(StorageInitTest, CreateStorageWithInvalidPgOpt) {
   pool.match([](const auto &) { FAIL() << "storage created, but should not"; },
              [](const auto &) { SUCCEED(); });
 }
+
+/**
+ * @given database with account details in the account.data column of the
+ * previous schema
+ * @when connection pool is prepared before and after the details are migrated
+ * @then the pool is not prepared until the migration
+ * @and the details are moved to account_has_detail and counted, and the column
+ * is kept
+ */
+TEST_F(StorageInitTest, MigrateAccountDetails) {
+  PostgresOptions options(pgopt_,
+                          integration_framework::kDefaultWorkingDatabaseName,
+                          storage_log_manager_->getLogger());
+  PgConnectionInit::createDatabaseIfNotExist(options).match(
+      [](auto &&val) {}, [&](auto &&error) { FAIL() << error.error; });
+  {
+    soci::session sql(*soci::factory_postgresql(),
+                      options.workingConnectionString());
+    sql << R"(
+      CREATE TABLE role (role_id character varying(32) PRIMARY KEY);
+      CREATE TABLE domain (
+          domain_id character varying(255) PRIMARY KEY,
+          default_role character varying(32) NOT NULL REFERENCES role);
+      CREATE TABLE account (
+          account_id character varying(288) PRIMARY KEY,
+          domain_id character varying(255) NOT NULL REFERENCES domain,
+          quorum int NOT NULL,
+          data JSONB);
+      INSERT INTO role VALUES ('user');
+      INSERT INTO domain VALUES ('domain', 'user');
+      INSERT INTO account VALUES
+          ('id@domain', 'domain', 1, '{"id@domain": {"key": "value"}}');
+    )";
+  }
+
+  auto prepare_pool = [&] {
+    return PgConnectionInit::prepareConnectionPool(
+        *reconnection_strategy_factory_,
+        options,
+        pool_size_,
+        getTestLoggerManager()->getChild("Storage"));
+  };
+  ASSERT_TRUE(hasError(prepare_pool()));
+
+  auto migrated = resultToOptionalValue(
+      PgConnectionInit::migrateAccountDetails(options));
+  ASSERT_TRUE(migrated and *migrated);
+  ASSERT_TRUE(hasValue(prepare_pool()));
+  auto migrated_again = resultToOptionalValue(
+      PgConnectionInit::migrateAccountDetails(options));
+  ASSERT_TRUE(migrated_again and not *migrated_again);
+
+  soci::session sql(*soci::factory_postgresql(),
+                    options.workingConnectionString());
+  std::string value;
+  sql << "SELECT value FROM account_has_detail WHERE account_id = 'id@domain' "
+         "AND writer = 'id@domain' AND key = 'key'",
+      soci::into(value);
+  ASSERT_EQ("value", value);
+  int backup_columns = 0;
+  sql << "SELECT count(1) FROM information_schema.columns "
+         "WHERE table_name = 'account' "
+         "AND column_name = 'data_before_account_has_detail'",
+      soci::into(backup_columns);
+  ASSERT_EQ(1, backup_columns);
+  int detail_count = 0;
+  sql << "SELECT count FROM account_detail_count "
+         "WHERE account_id = 'id@domain' AND writer = 'id@domain'",
+      soci::into(detail_count);
+  ASSERT_EQ(1, detail_count);
+}
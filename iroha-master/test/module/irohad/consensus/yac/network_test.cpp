@@ -5,6 +5,11 @@
 
 #include "consensus/yac/transport/impl/network_impl.hpp"
 
+#include <atomic>
+#include <future>
+#include <map>
+#include <thread>
+
 #include <grpc++/grpc++.h>
 
 #include "consensus/yac/transport/yac_pb_converters.hpp"
@@ -84,10 +89,70 @@ namespace iroha {
         ASSERT_EQ(request.votes_size(), 1);
       }
 
+      /**
+       * @given initialized network without connections
+       * @when states are sent to the same peers from several threads
+       * @then a single connection is created for each peer and every state
+       * is sent
+       */
+      TEST_F(YacNetworkTest, SendStateConcurrently) {
+        constexpr size_t kThreads = 4;
+        constexpr size_t kPeers = 8;
+        std::vector<std::unique_ptr<
+            grpc::testing::MockClientAsyncResponseReader<
+                google::protobuf::Empty>>>
+            readers;
+        for (size_t i = 0; i < kThreads * kPeers; ++i) {
+          readers.push_back(
+              std::make_unique<grpc::testing::MockClientAsyncResponseReader<
+                  google::protobuf::Empty>>());
+        }
+        std::atomic<size_t> sent{0};
+        std::mutex created_mutex;
+        std::map<std::string, size_t> created;
+        network = std::make_shared<NetworkImpl>(
+            async_call,
+            [&](const shared_model::interface::Peer &peer) {
+              {
+                std::lock_guard<std::mutex> lock(created_mutex);
+                ++created[peer.address()];
+              }
+              auto stub = std::make_unique<proto::MockYacStub>();
+              EXPECT_CALL(*stub, AsyncSendStateRaw(_, _, _))
+                  .WillRepeatedly(InvokeWithoutArgs(
+                      [&] { return readers.at(sent++).get(); }));
+              return stub;
+            },
+            getTestLogger("YacNetwork"));
+
+        std::vector<std::shared_ptr<shared_model::interface::Peer>> peers;
+        for (size_t i = 0; i < kPeers; ++i) {
+          peers.push_back(
+              makePeer(std::string(default_ip) + ":" + std::to_string(i + 1)));
+        }
+        std::vector<std::thread> threads;
+        for (size_t i = 0; i < kThreads; ++i) {
+          threads.emplace_back([&] {
+            for (const auto &peer : peers) {
+              network->sendState(*peer, {message});
+            }
+          });
+        }
+        for (auto &thread : threads) {
+          thread.join();
+        }
+
+        ASSERT_EQ(kThreads * kPeers, sent);
+        ASSERT_EQ(kPeers, created.size());
+        for (const auto &peer : created) {
+          EXPECT_EQ(1, peer.second) << peer.first;
+        }
+      }
+
       /**
        * @given initialized network
        * @when send request with one vote
-       * @then status OK
+       * @then status OK and the vote is passed to the subscriber
        */
       TEST_F(YacNetworkTest, SendMessage) {
         proto::State request;
@@ -96,8 +161,115 @@ namespace iroha {
         auto pb_vote = request.add_votes();
         *pb_vote = PbConverters::serializeVote(message);
 
+        std::promise<void> handled;
+        EXPECT_CALL(*notifications, onState(std::vector<VoteMessage>{message}))
+            .WillOnce(InvokeWithoutArgs([&handled] { handled.set_value(); }));
+
         auto response = network->SendState(&context, &request, nullptr);
         ASSERT_EQ(response.error_code(), grpc::StatusCode::OK);
+        ASSERT_EQ(std::future_status::ready,
+                  handled.get_future().wait_for(std::chrono::seconds(5)));
+      }
+
+      /**
+       * @given initialized network with one worker and one pending state
+       * allowed
+       * @when the subscriber is busy and two more states of the same round
+       * are received
+       * @then the first one is queued and the second one is rejected with
+       * status RESOURCE_EXHAUSTED
+       */
+      TEST_F(YacNetworkTest, SendMessageQueueFull) {
+        network = std::make_shared<NetworkImpl>(
+            async_call,
+            [](const auto &) { return nullptr; },
+            getTestLogger("YacNetwork"),
+            1,
+            1);
+        network->subscribe(notifications);
+
+        proto::State request;
+        grpc::ServerContext context;
+        *request.add_votes() = PbConverters::serializeVote(message);
+
+        std::promise<void> started, release, handled;
+        auto released = release.get_future().share();
+        EXPECT_CALL(*notifications, onState(_))
+            .WillOnce(InvokeWithoutArgs([&started, released] {
+              started.set_value();
+              released.wait();
+            }))
+            .WillOnce(InvokeWithoutArgs([&handled] { handled.set_value(); }));
+
+        ASSERT_EQ(network->SendState(&context, &request, nullptr).error_code(),
+                  grpc::StatusCode::OK);
+        started.get_future().wait();
+        ASSERT_EQ(network->SendState(&context, &request, nullptr).error_code(),
+                  grpc::StatusCode::OK);
+        ASSERT_EQ(network->SendState(&context, &request, nullptr).error_code(),
+                  grpc::StatusCode::RESOURCE_EXHAUSTED);
+
+        release.set_value();
+        ASSERT_EQ(std::future_status::ready,
+                  handled.get_future().wait_for(std::chrono::seconds(5)));
+      }
+
+      /**
+       * @given initialized network with one worker and one pending state
+       * allowed
+       * @when the subscriber is busy, a state is queued, and then states of
+       * an earlier and a later round are received
+       * @then the state of the earlier round is rejected
+       * @and the state of the later round replaces the queued one
+       */
+      TEST_F(YacNetworkTest, SendMessageQueueFullLaterRound) {
+        network = std::make_shared<NetworkImpl>(
+            async_call,
+            [](const auto &) { return nullptr; },
+            getTestLogger("YacNetwork"),
+            1,
+            1);
+        network->subscribe(notifications);
+
+        auto makeRequest = [this](Round round) {
+          auto vote = message;
+          vote.hash.vote_round = round;
+          proto::State request;
+          *request.add_votes() = PbConverters::serializeVote(vote);
+          return request;
+        };
+        auto later_vote = message;
+        later_vote.hash.vote_round = {3, 0};
+        grpc::ServerContext context;
+
+        std::promise<void> started, release, handled;
+        auto released = release.get_future().share();
+        EXPECT_CALL(*notifications, onState(_))
+            .WillOnce(InvokeWithoutArgs([&started, released] {
+              started.set_value();
+              released.wait();
+            }));
+        EXPECT_CALL(*notifications,
+                    onState(std::vector<VoteMessage>{later_vote}))
+            .WillOnce(InvokeWithoutArgs([&handled] { handled.set_value(); }));
+
+        auto busy = makeRequest({1, 0});
+        auto queued = makeRequest({2, 0});
+        auto earlier = makeRequest({1, 1});
+        auto later = makeRequest({3, 0});
+        ASSERT_EQ(network->SendState(&context, &busy, nullptr).error_code(),
+                  grpc::StatusCode::OK);
+        started.get_future().wait();
+        ASSERT_EQ(network->SendState(&context, &queued, nullptr).error_code(),
+                  grpc::StatusCode::OK);
+        ASSERT_EQ(network->SendState(&context, &earlier, nullptr).error_code(),
+                  grpc::StatusCode::RESOURCE_EXHAUSTED);
+        ASSERT_EQ(network->SendState(&context, &later, nullptr).error_code(),
+                  grpc::StatusCode::OK);
+
+        release.set_value();
+        ASSERT_EQ(std::future_status::ready,
+                  handled.get_future().wait_for(std::chrono::seconds(5)));
       }
 
       /**
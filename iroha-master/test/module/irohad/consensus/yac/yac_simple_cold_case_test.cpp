@@ -3,9 +3,12 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 
+#include <atomic>
+#include <future>
 #include <iostream>
 #include <memory>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -41,6 +44,33 @@ TEST_F(YacTest, YacWhenVoting) {
   yac->vote(my_hash, *order);
 }
 
+/**
+ * @given YAC which broadcasts votes
+ * @when it votes for a hash
+ * @then the vote is sent to all peers before the timer fires
+ * AND the peers are tried one by one after the timer fires
+ */
+TEST_F(YacTest, YacWhenVotingWithBroadcast) {
+  auto order = ClusterOrdering::create(default_peers);
+  ASSERT_TRUE(order);
+  initYac(*order, VoteDissemination::kBroadcast);
+
+  std::vector<std::string> addresses;
+  EXPECT_CALL(*network, sendState(_, _))
+      .Times(default_peers.size() * 2)
+      .WillRepeatedly(Invoke([&addresses](const auto &peer, const auto &) {
+        addresses.push_back(peer.address());
+      }));
+
+  YacHash my_hash(initial_round, "my_proposal_hash", "my_block_hash");
+  yac->vote(my_hash, *order);
+
+  // MockTimer invokes the fallback immediately after the broadcast
+  for (size_t i = 0; i < default_peers.size(); ++i) {
+    ASSERT_EQ(default_peers.at(i)->address(), addresses.at(i));
+  }
+}
+
 /**
  * Test provide scenario when yac cold started and achieve one vote
  */
@@ -207,3 +237,32 @@ TEST_F(YacTest, PropagateCommitBeforeNotifyingSubscribersApplyReject) {
   // verify that on_commit subscribers are notified
   ASSERT_EQ(1, messages.size());
 }
+
+/**
+ * @given initialized yac
+ * @when states of two peers are received from different threads
+ * @then their signatures are verified concurrently
+ */
+TEST_F(YacTest, StatesAreVerifiedConcurrently) {
+  std::atomic<int> entered{0};
+  std::promise<void> both_entered;
+  auto both_entered_future = both_entered.get_future().share();
+  EXPECT_CALL(*crypto, verify(_))
+      .Times(2)
+      .WillRepeatedly(Invoke([&](const auto &) {
+        if (++entered == 2) {
+          both_entered.set_value();
+        }
+        return both_entered_future.wait_for(std::chrono::seconds(5))
+            == std::future_status::ready;
+      }));
+
+  auto yac_hash = YacHash(initial_round, "proposal_hash", "block_hash");
+  std::thread first([&] { yac->onState({createVote(yac_hash, "0")}); });
+  std::thread second([&] { yac->onState({createVote(yac_hash, "1")}); });
+  first.join();
+  second.join();
+
+  ASSERT_EQ(std::future_status::ready,
+            both_entered_future.wait_for(std::chrono::seconds(0)));
+}
@@ -6,8 +6,15 @@
 #include <gtest/gtest.h>
 #include "logger/logger_manager.hpp"
 
+#include <chrono>
+#include <fstream>
+#include <sstream>
+#include <thread>
 #include <vector>
 
+#include <boost/filesystem.hpp>
+#include "logger/logger_spdlog.hpp"
+
 TEST(LoggerTest, basicStandaloneLoggerTest) {
   logger::LoggerConfig config;
   config.log_level = logger::LogLevel::kInfo;
@@ -42,3 +49,165 @@ TEST(LoggerTest, collectionToStringEmpty) {
                                [](auto val) { return std::to_string(val); });
   ASSERT_EQ("{}", res);
 }
+
+class LoggerRateLimitTest : public ::testing::Test {
+ public:
+  void SetUp() override {
+    log_path = (boost::filesystem::temp_directory_path()
+                / boost::filesystem::unique_path())
+                   .string();
+  }
+
+  void TearDown() override {
+    boost::filesystem::remove(log_path);
+  }
+
+  /// @return config of debug level logging to the log file with the limit
+  logger::LoggerConfig makeConfig(uint32_t rate_limit) {
+    logger::LoggerConfig config;
+    config.log_level = logger::LogLevel::kDebug;
+    config.rate_limit = rate_limit;
+    auto sinks = std::make_shared<logger::LogSinkConfig>();
+    sinks->file_path = log_path;
+    config.sinks = std::move(sinks);
+    return config;
+  }
+
+  /// @return logger with the given tag and config
+  logger::LoggerPtr makeLogger(const std::string &tag,
+                               logger::LoggerConfig config) {
+    return std::make_shared<logger::LoggerSpdlog>(
+        tag, std::make_shared<const logger::LoggerConfig>(std::move(config)));
+  }
+
+  /**
+   * Sleep until the next second of the steady clock, so that the following
+   * messages fall into a single rate limit window
+   */
+  void waitForNextSecond() {
+    using namespace std::chrono;
+    auto now = steady_clock::now().time_since_epoch();
+    std::this_thread::sleep_for(duration_cast<seconds>(now) + seconds(1)
+                                - now);
+  }
+
+  /// @return contents of the log file, flushed by an error message
+  std::string readLog(const logger::LoggerPtr &log) {
+    log->error("flush");
+    std::ifstream file(log_path);
+    std::stringstream contents;
+    contents << file.rdbuf();
+    return contents.str();
+  }
+
+  std::string log_path;
+};
+
+/**
+ * @given logger with the rate limit of 1 message per second
+ * @when 2 messages are logged in one second and 1 message in the next one
+ * @then the second message is dropped and the message of the next second is
+ * logged
+ */
+TEST_F(LoggerRateLimitTest, WindowRollover) {
+  auto log = makeLogger("rate_limit_rollover", makeConfig(1));
+
+  waitForNextSecond();
+  log->info("first message");
+  log->info("second message");
+  waitForNextSecond();
+  log->info("third message");
+
+  auto contents = readLog(log);
+  EXPECT_NE(std::string::npos, contents.find("first message")) << contents;
+  EXPECT_EQ(std::string::npos, contents.find("second message")) << contents;
+  EXPECT_NE(std::string::npos, contents.find("third message")) << contents;
+}
+
+/**
+ * @given logger with the rate limit of 1 message per second
+ * @when 3 messages are logged in one second and 1 message in the next one
+ * @then the number of dropped messages is reported before the message of the
+ * next second
+ */
+TEST_F(LoggerRateLimitTest, DroppedMessagesReport) {
+  auto log = makeLogger("rate_limit_report", makeConfig(1));
+
+  waitForNextSecond();
+  log->debug("first message");
+  log->debug("second message");
+  log->debug("third message");
+  waitForNextSecond();
+  log->debug("fourth message");
+
+  auto contents = readLog(log);
+  auto report = contents.find(
+      "2 messages were dropped by the rate limit of 1 messages per second");
+  ASSERT_NE(std::string::npos, report) << contents;
+  EXPECT_LT(report, contents.find("fourth message")) << contents;
+}
+
+/**
+ * @given logger with the rate limit of 1 message per second
+ * @when an info message, warnings and errors are logged in one second
+ * @then the warnings and errors are logged in spite of the limit
+ * @and the next info message is dropped
+ */
+TEST_F(LoggerRateLimitTest, WarningsPassLimit) {
+  auto log = makeLogger("rate_limit_warnings", makeConfig(1));
+
+  waitForNextSecond();
+  log->info("info message");
+  log->warn("first warning");
+  log->warn("second warning");
+  log->error("error message");
+  log->info("dropped message");
+
+  auto contents = readLog(log);
+  EXPECT_NE(std::string::npos, contents.find("first warning")) << contents;
+  EXPECT_NE(std::string::npos, contents.find("second warning")) << contents;
+  EXPECT_NE(std::string::npos, contents.find("error message")) << contents;
+  EXPECT_EQ(std::string::npos, contents.find("dropped message")) << contents;
+}
+
+/**
+ * @given logger manager with the rate limit of 1 message per second
+ * @when one child is registered without a rate limit, one with the limit of
+ * 0 and another one is created on request
+ * @then the children without a limit of their own inherit the limit
+ * @and the child with the limit of 0 is not limited
+ */
+TEST_F(LoggerRateLimitTest, ChildrenInheritRateLimit) {
+  logger::LoggerManagerTree manager(makeConfig(1));
+  auto registered = manager
+                        .registerChild("rate_limit_registered",
+                                       boost::none,
+                                       boost::none,
+                                       boost::none)
+                        ->getLogger();
+  auto unlimited =
+      manager.registerChild("rate_limit_unlimited", boost::none, boost::none, 0)
+          ->getLogger();
+  auto requested = manager.getChild("rate_limit_requested")->getLogger();
+
+  waitForNextSecond();
+  for (const auto &log : {registered, unlimited, requested}) {
+    log->info("first message");
+    log->info("second message");
+  }
+
+  auto contents = readLog(registered);
+  auto count = [&contents](const std::string &message) {
+    size_t count = 0;
+    for (auto pos = contents.find(message); pos != std::string::npos;
+         pos = contents.find(message, pos + 1)) {
+      ++count;
+    }
+    return count;
+  };
+  EXPECT_EQ(3u, count("first message")) << contents;
+  EXPECT_EQ(1u, count("second message")) << contents;
+  EXPECT_NE(std::string::npos,
+            contents.find("[rate_limit_unlimited]: second message"))
+      << contents;
+}
@@ -0,0 +1,136 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "main/iroha_conf_loader.hpp"
+
+#include <chrono>
+#include <fstream>
+#include <sstream>
+#include <thread>
+
+#include <gtest/gtest.h>
+#include <boost/filesystem.hpp>
+#include "logger/logger.hpp"
+#include "logger/logger_manager.hpp"
+
+class IrohaConfLoaderTest : public ::testing::Test {
+ public:
+  void SetUp() override {
+    auto dir = boost::filesystem::temp_directory_path();
+    config_path = (dir / boost::filesystem::unique_path()).string();
+    log_path = (dir / boost::filesystem::unique_path()).string();
+  }
+
+  void TearDown() override {
+    boost::filesystem::remove(config_path);
+    boost::filesystem::remove(log_path);
+  }
+
+  /**
+   * Write a config with the given root logger section and parse it
+   * @param log_section - JSON object of the root logger
+   * @return the parsed config
+   */
+  IrohadConfig parseWithLog(const std::string &log_section) {
+    {
+      std::ofstream file(config_path);
+      file << R"({
+        "block_store_path": "/tmp/block_store/",
+        "torii_port": 50051,
+        "internal_port": 10001,
+        "max_proposal_size": 10,
+        "proposal_delay": 5000,
+        "vote_delay": 5000,
+        "mst_enable": false,
+        "log": )"
+           << log_section << "}";
+    }
+    return parse_iroha_config(config_path, nullptr);
+  }
+
+  /**
+   * Wait until the log file contains the message, since the asynchronous
+   * loggers write it on another thread
+   * @return true if the message is found in a second
+   */
+  bool waitForLogMessage(const std::string &message) {
+    for (int i = 0; i < 100; ++i) {
+      std::ifstream file(log_path);
+      std::stringstream contents;
+      contents << file.rdbuf();
+      if (contents.str().find(message) != std::string::npos) {
+        return true;
+      }
+      std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    return false;
+  }
+
+  std::string config_path;
+  std::string log_path;
+};
+
+/**
+ * @given config with the file section of the root logger
+ * @when the config is parsed and a child logger writes a warning
+ * @then the warning is written to the log file
+ */
+TEST_F(IrohaConfLoaderTest, LogFileSection) {
+  auto config = parseWithLog(R"({"file": {"path": ")" + log_path
+                             + R"(", "max_size": 1048576, "max_files": 1}})");
+  ASSERT_TRUE(config.logger_manager);
+
+  (*config.logger_manager)
+      ->getChild("conf_loader_file")
+      ->getLogger()
+      ->warn("file section message");
+
+  EXPECT_TRUE(waitForLogMessage("file section message"));
+}
+
+/**
+ * @given config with the file and async sections of the root logger
+ * @when the config is parsed and a child logger writes a warning
+ * @then the warning is written to the log file by the asynchronous logger
+ */
+TEST_F(IrohaConfLoaderTest, LogAsyncSection) {
+  auto config = parseWithLog(
+      R"({"file": {"path": ")" + log_path
+      + R"("}, "async": {"queue_size": 1024, "overflow": "drop_oldest"}})");
+  ASSERT_TRUE(config.logger_manager);
+
+  (*config.logger_manager)
+      ->getChild("conf_loader_async")
+      ->getLogger()
+      ->warn("async section message");
+
+  EXPECT_TRUE(waitForLogMessage("async section message"));
+}
+
+/**
+ * @given config with an unknown overflow policy of the asynchronous logging
+ * @when the config is parsed
+ * @then an error naming the allowed policies is thrown
+ */
+TEST_F(IrohaConfLoaderTest, WrongLogOverflowPolicy) {
+  try {
+    parseWithLog(R"({"async": {"queue_size": 1024, "overflow": "drop"}})");
+    FAIL() << "config with a wrong overflow policy is parsed";
+  } catch (const std::runtime_error &error) {
+    EXPECT_NE(std::string::npos,
+              std::string(error.what()).find("Wrong overflow policy"))
+        << error.what();
+  }
+}
+
+/**
+ * @given config with the async section without a queue size
+ * @when the config is parsed
+ * @then an error is thrown
+ */
+TEST_F(IrohaConfLoaderTest, LogAsyncSectionWithoutQueueSize) {
+  EXPECT_THROW(parseWithLog(R"({"async": {"overflow": "block"}})"),
+               std::runtime_error);
+}
@@ -374,3 +374,39 @@ TEST_F(MstProcessorTest, receivedOneOfExistingTxs) {
 
   check(observers);
 }
+
+/**
+ * @given initialised mst processor
+ * AND our state contains two batches with quorum 3
+ *
+ * @when received other peer's state contains both batches, but only one of
+ * them has a new signature
+ *
+ * @then only the batch with the new signature is emitted as updated
+ */
+TEST_F(MstProcessorTest, onlyChangedBatchesAreUpdated) {
+  const auto unchanged_batch = addSignaturesFromKeyPairs(
+      makeTestBatch(txBuilder(1, time_now, 3)), 0, makeKey());
+  mst_processor->propagateBatch(unchanged_batch);
+  mst_processor->propagateBatch(addSignaturesFromKeyPairs(
+      makeTestBatch(txBuilder(2, time_now, 3)), 0, makeKey()));
+
+  auto received_state = MstState::empty(getTestLogger("MstState"),
+                                        std::make_shared<TestCompleter>());
+  received_state += unchanged_batch;
+  const auto changed_batch = addSignaturesFromKeyPairs(
+      makeTestBatch(txBuilder(2, time_now, 3)), 0, makeKey());
+  received_state += changed_batch;
+
+  auto observers = initObservers(mst_processor, 1, 0, 0);
+  std::shared_ptr<MstState> updated_state;
+  mst_processor->onStateUpdate().subscribe(
+      [&updated_state](auto state) { updated_state = std::move(state); });
+  shared_model::crypto::PublicKey another_peer_key("another_pubkey");
+  mst_processor->onNewState(another_peer_key, received_state);
+
+  check(observers);
+  ASSERT_TRUE(updated_state);
+  ASSERT_EQ(1, updated_state->getBatches().size());
+  ASSERT_TRUE(updated_state->contains(changed_batch));
+}
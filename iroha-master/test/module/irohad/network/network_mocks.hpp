@@ -35,6 +35,11 @@ namespace iroha {
 
       MOCK_CONST_METHOD0(onProposal, rxcpp::observable<OrderingEvent>());
 
+      MOCK_CONST_METHOD0(
+          onExpiredBatches,
+          rxcpp::observable<
+              std::shared_ptr<shared_model::interface::TransactionBatch>>());
+
       MOCK_CONST_METHOD0(
           onSynchronization,
           rxcpp::observable<synchronizer::SynchronizationEvent>());
@@ -71,6 +76,11 @@ namespace iroha {
 
       MOCK_METHOD0(onProposal, rxcpp::observable<OrderingEvent>());
 
+      MOCK_METHOD0(
+          onExpiredBatches,
+          rxcpp::observable<
+              std::shared_ptr<shared_model::interface::TransactionBatch>>());
+
       MOCK_METHOD1(setPcs, void(const PeerCommunicationService &));
     };
 
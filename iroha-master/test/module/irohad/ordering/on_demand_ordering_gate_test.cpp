@@ -7,6 +7,7 @@
 
 #include <gtest/gtest.h>
 #include <boost/range/adaptor/indirected.hpp>
+#include "datetime/time.hpp"
 #include "framework/test_logger.hpp"
 #include "framework/test_subscriber.hpp"
 #include "interfaces/iroha_internal/transaction_batch_impl.hpp"
@@ -38,14 +39,28 @@ class OnDemandOrderingGateTest : public ::testing::Test {
     ordering_service = std::make_shared<MockOnDemandOrderingService>();
     notification = std::make_shared<MockOdOsNotification>();
     cache = std::make_shared<cache::MockOrderingGateCache>();
-    auto ufactory = std::make_unique<NiceMock<MockUnsafeProposalFactory>>();
-    factory = ufactory.get();
     tx_cache = std::make_shared<ametsuchi::MockTxPresenceCache>();
     ON_CALL(*tx_cache,
             check(testing::Matcher<const shared_model::crypto::Hash &>(_)))
         .WillByDefault(
             Return(boost::make_optional<ametsuchi::TxCacheStatusType>(
                 iroha::ametsuchi::tx_cache_status_responses::Missing())));
+    initGate(std::chrono::milliseconds::zero());
+
+    auto peer = makePeer("127.0.0.1", shared_model::crypto::PublicKey("111"));
+    ledger_state = std::make_shared<LedgerState>(
+        shared_model::interface::types::PeerList{std::move(peer)},
+        round.block_round,
+        shared_model::crypto::Hash{"hash"});
+  }
+
+  /**
+   * Create the ordering gate
+   * @param tx_ttl - time since creation after which transactions are dropped
+   */
+  void initGate(std::chrono::milliseconds tx_ttl) {
+    auto ufactory = std::make_unique<NiceMock<MockUnsafeProposalFactory>>();
+    factory = ufactory.get();
     ordering_gate = std::make_shared<OnDemandOrderingGate>(
         ordering_service,
         notification,
@@ -55,13 +70,8 @@ class OnDemandOrderingGateTest : public ::testing::Test {
         std::move(ufactory),
         tx_cache,
         1000,
+        tx_ttl,
         getTestLogger("OrderingGate"));
-
-    auto peer = makePeer("127.0.0.1", shared_model::crypto::PublicKey("111"));
-    ledger_state = std::make_shared<LedgerState>(
-        shared_model::interface::types::PeerList{std::move(peer)},
-        round.block_round,
-        shared_model::crypto::Hash{"hash"});
   }
 
   rxcpp::subjects::subject<
@@ -302,6 +312,46 @@ TEST_F(OnDemandOrderingGateTest, PopNonEmptyBatchesFromTheCache) {
       OnDemandOrderingGate::RoundSwitch(round, ledger_state));
 }
 
+/**
+ * @given ordering gate with a transaction ttl of an hour
+ * @when block event is emitted @and cache contains an expired batch and a
+ * fresh batch on the head
+ * @then only the fresh batch is propagated to network and kept in the cache
+ * @and the expired batch is emitted by the gate
+ */
+TEST_F(OnDemandOrderingGateTest, ExpiredBatchesAreDroppedFromTheCache) {
+  const std::chrono::milliseconds ttl = std::chrono::hours(1);
+  initGate(ttl);
+
+  auto now = iroha::time::now();
+  auto tx1 = createMockTransactionWithHash(
+      shared_model::interface::types::HashType("hash1"));
+  ON_CALL(*tx1, createdTime()).WillByDefault(Return(now - 2 * ttl.count()));
+  auto tx2 = createMockTransactionWithHash(
+      shared_model::interface::types::HashType("hash2"));
+  ON_CALL(*tx2, createdTime()).WillByDefault(Return(now));
+
+  auto expired_batch = createMockBatchWithTransactions({tx1}, "a");
+  auto fresh_batch = createMockBatchWithTransactions({tx2}, "b");
+  cache::OrderingGateCache::BatchesSetType collection{expired_batch,
+                                                      fresh_batch};
+
+  EXPECT_CALL(*cache, pop()).WillOnce(Return(collection));
+  EXPECT_CALL(*cache, addToBack(UnorderedElementsAre(fresh_batch))).Times(1);
+  EXPECT_CALL(*notification, onBatches(UnorderedElementsAre(fresh_batch)))
+      .Times(1);
+
+  auto expired_wrapper =
+      make_test_subscriber<CallExact>(ordering_gate->onExpiredBatches(), 1);
+  expired_wrapper.subscribe(
+      [&](auto batch) { ASSERT_EQ(expired_batch, batch); });
+
+  rounds.get_subscriber().on_next(
+      OnDemandOrderingGate::RoundSwitch(round, ledger_state));
+
+  ASSERT_TRUE(expired_wrapper.validate());
+}
+
 /**
  * @given initialized ordering gate
  * @when block event with no batches is emitted @and cache contains no batches
@@ -124,12 +124,13 @@ TEST_F(OnDemandOsClientGrpcTest, onRequestProposal) {
   std::chrono::system_clock::time_point deadline;
   proto::ProposalRequest request;
   auto creator = "test";
-  proto::ProposalResponse response;
-  response.mutable_proposal()
-      ->add_transactions()
+  protocol::Proposal response_proposal;
+  response_proposal.add_transactions()
       ->mutable_payload()
       ->mutable_reduced_payload()
       ->set_creator_account_id(creator);
+  proto::ProposalResponse response;
+  response.set_proposal(response_proposal.SerializeAsString());
   EXPECT_CALL(*stub, RequestProposal(_, _, _))
       .WillOnce(DoAll(SaveClientContextDeadline(&deadline),
                       SaveArg<1>(&request),
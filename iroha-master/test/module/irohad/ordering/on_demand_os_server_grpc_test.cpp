@@ -131,9 +131,11 @@ TEST_F(OnDemandOsServerGrpcTest, RequestProposal) {
 
   server->RequestProposal(nullptr, &request, &response);
 
-  ASSERT_TRUE(response.has_proposal());
-  ASSERT_EQ(response.proposal()
-                .transactions()
+  ASSERT_EQ(proto::ProposalResponse::kProposal,
+            response.optional_proposal_case());
+  protocol::Proposal response_proposal;
+  ASSERT_TRUE(response_proposal.ParseFromString(response.proposal()));
+  ASSERT_EQ(response_proposal.transactions()
                 .Get(0)
                 .payload()
                 .reduced_payload()
@@ -157,5 +159,6 @@ TEST_F(OnDemandOsServerGrpcTest, RequestProposalNone) {
 
   server->RequestProposal(nullptr, &request, &response);
 
-  ASSERT_FALSE(response.has_proposal());
+  ASSERT_EQ(proto::ProposalResponse::OPTIONAL_PROPOSAL_NOT_SET,
+            response.optional_proposal_case());
 }
@@ -5,6 +5,7 @@
 
 #include "ordering/impl/on_demand_ordering_service_impl.hpp"
 
+#include <algorithm>
 #include <memory>
 #include <thread>
 
@@ -41,6 +42,9 @@ class OnDemandOsTest : public ::testing::Test {
  public:
   std::shared_ptr<OnDemandOrderingService> os;
   const uint64_t transaction_limit = 20;
+  const uint64_t max_pending_batches = 0;
+  const std::chrono::milliseconds tx_ttl{0};
+  const ProposalBudget proposal_budget{};
   const uint32_t proposal_limit = 5;
   const consensus::Round initial_round = {2, kFirstRejectRound},
                          target_round = {4, kNextCommitRoundConsumer},
@@ -49,6 +53,23 @@ class OnDemandOsTest : public ::testing::Test {
   NiceMock<iroha::ametsuchi::MockTxPresenceCache> *mock_cache;
 
   void SetUp() override {
+    os = createOs(
+        transaction_limit, max_pending_batches, tx_ttl, proposal_budget);
+  }
+
+  /**
+   * Create the OS, which considers every batch new by default
+   * @param limit - max number of transactions in a proposal
+   * @param max_pending - max number of pending batches, 0 means no limit
+   * @param ttl - transaction ttl, 0 means no expiration
+   * @param budget - proposal budget
+   * @return the OS
+   */
+  std::shared_ptr<OnDemandOrderingService> createOs(
+      uint64_t limit,
+      uint64_t max_pending,
+      std::chrono::milliseconds ttl,
+      ProposalBudget budget) {
     // TODO: nickaleks IR-1811 use mock factory
     auto factory = std::make_unique<
         shared_model::proto::ProtoProposalFactory<MockProposalValidator>>(
@@ -56,7 +77,6 @@ class OnDemandOsTest : public ::testing::Test {
     auto tx_cache =
         std::make_unique<NiceMock<iroha::ametsuchi::MockTxPresenceCache>>();
     mock_cache = tx_cache.get();
-    // every batch is new by default
     ON_CALL(
         *mock_cache,
         check(
@@ -64,8 +84,11 @@ class OnDemandOsTest : public ::testing::Test {
                 _)))
         .WillByDefault(Return(std::vector<iroha::ametsuchi::TxCacheStatusType>{
             iroha::ametsuchi::tx_cache_status_responses::Missing()}));
-    os = std::make_shared<OnDemandOrderingServiceImpl>(
-        transaction_limit,
+    return std::make_shared<OnDemandOrderingServiceImpl>(
+        limit,
+        max_pending,
+        ttl,
+        std::move(budget),
         std::move(factory),
         std::move(tx_cache),
         getTestLogger("OdOrderingService"),
@@ -174,6 +197,9 @@ TEST_F(OnDemandOsTest, DISABLED_ConcurrentInsert) {
       std::make_unique<NiceMock<iroha::ametsuchi::MockTxPresenceCache>>();
   os = std::make_shared<OnDemandOrderingServiceImpl>(
       large_tx_limit,
+      max_pending_batches,
+      tx_ttl,
+      proposal_budget,
       std::move(factory),
       std::move(tx_cache),
       getTestLogger("OdOrderingService"),
@@ -246,6 +272,9 @@ TEST_F(OnDemandOsTest, UseFactoryForProposal) {
       }));
   os = std::make_shared<OnDemandOrderingServiceImpl>(
       transaction_limit,
+      max_pending_batches,
+      tx_ttl,
+      proposal_budget,
       std::move(factory),
       std::move(tx_cache),
       getTestLogger("OdOrderingService"),
@@ -392,3 +421,107 @@ TEST_F(OnDemandOsTest, RejectCommit) {
   proposal = os->onRequestProposal(commit_round);
   ASSERT_EQ(2, boost::size((*proposal)->transactions()));
 }
+
+/**
+ * @given initialized on-demand OS with a limit of pending batches less than
+ * the transaction limit
+ * @when more batches than the limit arrive
+ * @then the batches over the limit are dropped
+ */
+TEST_F(OnDemandOsTest, PendingBatchesLimit) {
+  const uint64_t pending_limit = transaction_limit / 2;
+  os = createOs(transaction_limit, pending_limit, tx_ttl, proposal_budget);
+
+  generateTransactionsAndInsert({1, transaction_limit});
+  os->onCollaborationOutcome(commit_round);
+
+  ASSERT_EQ(pending_limit,
+            (*os->onRequestProposal(target_round))->transactions().size());
+}
+
+/**
+ * @given initialized on-demand OS with a transaction ttl of an hour
+ * @when batches created two hours ago and fresh batches arrive
+ * @then only the fresh batches are included in the proposal
+ */
+TEST_F(OnDemandOsTest, ExpiredBatchesAreDropped) {
+  const std::chrono::milliseconds ttl = std::chrono::hours(1);
+  os = createOs(transaction_limit, max_pending_batches, ttl, proposal_budget);
+
+  os->onBatches(
+      generateTransactions({1, 3}, iroha::time::now() - 2 * ttl.count()));
+  generateTransactionsAndInsert({3, 4});
+  os->onCollaborationOutcome(commit_round);
+
+  ASSERT_EQ(1, (*os->onRequestProposal(target_round))->transactions().size());
+}
+
+/**
+ * @given initialized on-demand OS with a budget of commands less than the
+ * transaction limit
+ * @when more single command transactions than the budget arrive
+ * @then the proposal contains only the budgeted amount of transactions
+ */
+TEST_F(OnDemandOsTest, ProposalBudgetLimit) {
+  ProposalBudget budget;
+  budget.max_commands = transaction_limit / 4;
+  os = createOs(transaction_limit, max_pending_batches, tx_ttl, budget);
+
+  generateTransactionsAndInsert({1, transaction_limit});
+  os->onCollaborationOutcome(commit_round);
+
+  ASSERT_EQ(budget.max_commands,
+            (*os->onRequestProposal(target_round))->transactions().size());
+}
+
+/**
+ * @given initialized on-demand OS with a budget of commands
+ * @when a transaction with more commands than the budget arrives together with
+ * smaller ones
+ * AND two rounds are rejected
+ * @then the oversized transaction is packed in one of the proposals
+ */
+TEST_F(OnDemandOsTest, OversizedBatchIsNotStarved) {
+  ProposalBudget budget;
+  budget.max_commands = 2;
+  os = createOs(transaction_limit, max_pending_batches, tx_ttl, budget);
+
+  generateTransactionsAndInsert({1, transaction_limit});
+  OnDemandOrderingService::CollectionType oversized;
+  oversized.push_back(
+      std::make_unique<shared_model::interface::TransactionBatchImpl>(
+          shared_model::interface::types::SharedTxsCollectionType{
+              std::make_unique<shared_model::proto::Transaction>(
+                  shared_model::proto::TransactionBuilder()
+                      .createdTime(iroha::time::now())
+                      .creatorAccountId("foo@bar")
+                      .createAsset("asset", "domain", 1)
+                      .createAsset("asset", "domain", 1)
+                      .createAsset("asset", "domain", 1)
+                      .quorum(1)
+                      .build()
+                      .signAndAddSignature(
+                          shared_model::crypto::DefaultCryptoAlgorithmType::
+                              generateKeypair())
+                      .finish())}));
+  os->onBatches(std::move(oversized));
+
+  consensus::Round first_round{initial_round.block_round,
+                               initial_round.reject_round + 1},
+      second_round{initial_round.block_round, initial_round.reject_round + 2};
+  os->onCollaborationOutcome(first_round);
+  os->onCollaborationOutcome(second_round);
+
+  auto has_oversized = [](const auto &proposal) {
+    return std::any_of(proposal->transactions().begin(),
+                       proposal->transactions().end(),
+                       [](const auto &tx) {
+                         return boost::size(tx.commands()) == 3;
+                       });
+  };
+  auto first = os->onRequestProposal(second_round);
+  auto second = os->onRequestProposal(
+      {initial_round.block_round, initial_round.reject_round + 3});
+  ASSERT_TRUE(first and second);
+  ASSERT_TRUE(has_oversized(*first) or has_oversized(*second));
+}
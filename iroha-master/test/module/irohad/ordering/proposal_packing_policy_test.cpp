@@ -0,0 +1,114 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ordering/impl/proposal_packing_policy.hpp"
+
+#include <gtest/gtest.h>
+#include "builders/protobuf/transaction.hpp"
+#include "datetime/time.hpp"
+#include "framework/test_logger.hpp"
+#include "interfaces/iroha_internal/transaction_batch_impl.hpp"
+
+using namespace iroha::ordering;
+
+class ProposalPackingPolicyTest : public ::testing::Test {
+ public:
+  ProposalPackingPolicy makePolicy(size_t max_transactions,
+                                   ProposalBudget budget) {
+    return ProposalPackingPolicy(
+        max_transactions, std::move(budget), getTestLogger("PackingPolicy"));
+  }
+
+  /**
+   * @return usage of the given amount of transactions, each of them has a
+   * single command of cost 1 and the given size
+   */
+  ProposalPackingPolicy::Usage makeUsage(size_t transactions,
+                                         size_t tx_bytes) {
+    ProposalPackingPolicy::Usage usage;
+    usage.transactions = transactions;
+    usage.bytes = transactions * tx_bytes;
+    usage.commands = transactions;
+    usage.cost = transactions;
+    return usage;
+  }
+};
+
+/**
+ * @given packing policy with the command cost of TransferAsset
+ * @when usage of a batch with a transaction of CreateAsset and TransferAsset
+ * commands is measured
+ * @then it has the size of the transaction, 2 commands and the cost of both
+ */
+TEST_F(ProposalPackingPolicyTest, BatchUsage) {
+  ProposalBudget budget;
+  budget.max_cost = 100;
+  budget.command_costs = {{"TransferAsset", 10}};
+  auto policy = makePolicy(10, budget);
+
+  std::shared_ptr<shared_model::interface::Transaction> tx =
+      std::make_shared<shared_model::proto::Transaction>(
+          shared_model::proto::TransactionBuilder()
+              .createdTime(iroha::time::now())
+              .creatorAccountId("foo@bar")
+              .createAsset("asset", "bar", 1)
+              .transferAsset("foo@bar", "baz@bar", "asset#bar", "", "1.0")
+              .quorum(1)
+              .build()
+              .signAndAddSignature(shared_model::crypto::
+                                       DefaultCryptoAlgorithmType::
+                                           generateKeypair())
+              .finish());
+  shared_model::interface::TransactionBatchImpl batch(
+      shared_model::interface::types::SharedTxsCollectionType{tx});
+
+  auto usage = policy.usage(batch);
+  EXPECT_EQ(1, usage.transactions);
+  EXPECT_EQ(tx->blob().size(), usage.bytes);
+  EXPECT_EQ(2, usage.commands);
+  EXPECT_EQ(11, usage.cost);
+}
+
+/**
+ * @given packing policy with a limit of bytes and commands
+ * @when batches within and over the budget are added to a proposal
+ * @then only the batches within the budget fit
+ */
+TEST_F(ProposalPackingPolicyTest, BudgetLimits) {
+  ProposalBudget budget;
+  budget.max_bytes = 1000;
+  budget.max_commands = 5;
+  auto policy = makePolicy(10, budget);
+
+  EXPECT_TRUE(policy.fits(makeUsage(2, 100), makeUsage(3, 100)));
+  EXPECT_FALSE(policy.fits(makeUsage(3, 100), makeUsage(3, 100)));
+  EXPECT_FALSE(policy.fits(makeUsage(1, 500), makeUsage(1, 600)));
+}
+
+/**
+ * @given packing policy with a limit of bytes and transactions
+ * @when a batch exceeding the budget on its own is added to an empty proposal
+ * @then it fits unless it exceeds the transactions limit
+ */
+TEST_F(ProposalPackingPolicyTest, OversizedBatchFitsEmptyProposal) {
+  ProposalBudget budget;
+  budget.max_bytes = 1000;
+  auto policy = makePolicy(2, budget);
+
+  EXPECT_TRUE(policy.fits({}, makeUsage(1, 2000)));
+  EXPECT_FALSE(policy.fits({}, makeUsage(3, 10)));
+}
+
+/**
+ * @given packing policy with a limit of transactions
+ * @when the proposal is checked with less and with the limit of transactions
+ * @then it is full only at the limit
+ */
+TEST_F(ProposalPackingPolicyTest, FullAtTransactionsLimit) {
+  auto policy = makePolicy(2, {});
+
+  EXPECT_FALSE(policy.full(makeUsage(1, 10)));
+  EXPECT_TRUE(policy.full(makeUsage(2, 10)));
+}
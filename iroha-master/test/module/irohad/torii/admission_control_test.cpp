@@ -0,0 +1,126 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "torii/impl/admission_control.hpp"
+
+#include <gtest/gtest.h>
+#include "cryptography/crypto_provider/crypto_defaults.hpp"
+#include "datetime/time.hpp"
+#include "framework/test_logger.hpp"
+#include "module/shared_model/builders/protobuf/test_transaction_builder.hpp"
+
+using namespace iroha::torii;
+
+using shared_model::crypto::DefaultCryptoAlgorithmType;
+using shared_model::crypto::Keypair;
+
+class AdmissionControlTest : public ::testing::Test {
+ public:
+  /**
+   * @param creators - creator account of each transaction
+   * @param keypair - keypair to sign the transactions
+   * @return transactions of the creators
+   */
+  shared_model::interface::types::SharedTxsCollectionType makeTransactions(
+      std::vector<std::string> creators, const Keypair &keypair) {
+    shared_model::interface::types::SharedTxsCollectionType transactions;
+    for (auto &creator : creators) {
+      transactions.push_back(std::make_shared<ProtoTxType>(
+          TestUnsignedTransactionBuilder()
+              .createdTime(iroha::time::now() + transactions.size())
+              .creatorAccountId(creator)
+              .quorum(1)
+              .build()
+              .signAndAddSignature(keypair)
+              .finish()));
+    }
+    return transactions;
+  }
+
+  /// @return transactions of the creators signed by the default keypair
+  shared_model::interface::types::SharedTxsCollectionType makeTransactions(
+      std::vector<std::string> creators) {
+    return makeTransactions(std::move(creators), keypair);
+  }
+
+  /**
+   * @param creator - creator account of the transaction
+   * @return transaction with a signature made by another key than the one
+   * declared in it
+   */
+  shared_model::interface::types::SharedTxsCollectionType makeForgedTransaction(
+      const std::string &creator) {
+    auto tx = TestUnsignedTransactionBuilder()
+                  .createdTime(iroha::time::now())
+                  .creatorAccountId(creator)
+                  .quorum(1)
+                  .build()
+                  .signAndAddSignature(other_keypair)
+                  .finish()
+                  .getTransport();
+    tx.mutable_signatures(0)->set_public_key(keypair.publicKey().hex());
+    return {std::make_shared<ProtoTxType>(std::move(tx))};
+  }
+
+  const Keypair keypair = DefaultCryptoAlgorithmType::generateKeypair();
+  const Keypair other_keypair = DefaultCryptoAlgorithmType::generateKeypair();
+
+  std::unique_ptr<AdmissionControl> makeAdmissionControl(
+      AdmissionLimits limits) {
+    return std::make_unique<AdmissionControl>(
+        limits, getTestLogger("AdmissionControl"));
+  }
+};
+
+/**
+ * @given admission control with the account rate limit of 2 transactions
+ * @when an account sends 2 transactions and then 1 more
+ * @then the first request is admitted and the second one is rejected
+ * @and the transactions of another account are admitted
+ */
+TEST_F(AdmissionControlTest, AccountRateLimit) {
+  auto admission_control = makeAdmissionControl({2, 0});
+
+  ASSERT_TRUE(
+      admission_control->admit(makeTransactions({"a@d", "a@d"}), "client"));
+  ASSERT_FALSE(admission_control->admit(makeTransactions({"a@d"}), "client"));
+  ASSERT_TRUE(admission_control->admit(makeTransactions({"b@d"}), "client"));
+}
+
+/**
+ * @given admission control with the account rate limit of 1 transaction
+ * @when a client sends transactions of an account with the public key of
+ * another signer and a wrong signature
+ * @then the transactions do not take the quota of the other signer
+ * @and the transactions of the account signed by another key are admitted
+ * after the quota of the first key is used
+ */
+TEST_F(AdmissionControlTest, AccountRateLimitBySigner) {
+  auto admission_control = makeAdmissionControl({1, 0});
+
+  ASSERT_TRUE(admission_control->admit(makeForgedTransaction("a@d"), "client"));
+  ASSERT_TRUE(admission_control->admit(makeTransactions({"a@d"}), "client"));
+  ASSERT_FALSE(admission_control->admit(makeTransactions({"a@d"}), "client"));
+  ASSERT_TRUE(admission_control->admit(
+      makeTransactions({"a@d"}, other_keypair), "client"));
+}
+
+/**
+ * @given admission control with the client rate limit of 2 transactions
+ * @when a client sends a request larger than the limit
+ * @then the request is admitted since the bucket of the client is full
+ * @and the next request of the client is rejected
+ * @and the requests of another client are admitted
+ */
+TEST_F(AdmissionControlTest, ClientRateLimit) {
+  auto admission_control = makeAdmissionControl({0, 2});
+
+  ASSERT_TRUE(admission_control->admit(
+      makeTransactions({"a@d", "b@d", "c@d"}), "ipv4:1.1.1.1"));
+  ASSERT_FALSE(
+      admission_control->admit(makeTransactions({"d@d"}), "ipv4:1.1.1.1"));
+  ASSERT_TRUE(
+      admission_control->admit(makeTransactions({"d@d"}), "ipv4:2.2.2.2"));
+}
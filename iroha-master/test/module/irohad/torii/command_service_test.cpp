@@ -78,9 +78,9 @@ TEST_F(CommandServiceTest, getStatusStreamWithAbsentHash) {
               check(Matcher<const shared_model::crypto::Hash &>(_)))
       .Times(1)
       .WillOnce(Return(ret_value));
-  EXPECT_CALL(*status_bus_, statuses())
+  EXPECT_CALL(*status_bus_, batches())
       .WillRepeatedly(Return(
-          rxcpp::observable<>::empty<iroha::torii::StatusBus::Objects>()));
+          rxcpp::observable<>::empty<iroha::torii::StatusBus::BatchPtr>()));
 
   initCommandService();
   auto wrapper = framework::test_subscriber::make_test_subscriber<
@@ -105,9 +105,9 @@ TEST_F(CommandServiceTest, ProcessBatchOn) {
   auto hash = shared_model::crypto::Hash("a");
   auto batch = createMockBatchWithTransactions(
       {createMockTransactionWithHash(hash)}, "a");
-  EXPECT_CALL(*status_bus_, statuses())
+  EXPECT_CALL(*status_bus_, batches())
       .WillRepeatedly(Return(
-          rxcpp::observable<>::empty<iroha::torii::StatusBus::Objects>()));
+          rxcpp::observable<>::empty<iroha::torii::StatusBus::BatchPtr>()));
 
   EXPECT_CALL(
       *tx_presence_cache_,
@@ -120,3 +120,38 @@ TEST_F(CommandServiceTest, ProcessBatchOn) {
   initCommandService();
   command_service_->handleTransactionBatch(batch);
 }
+
+/**
+ * @given initialized command service
+ * @when a batch with statuses of several transactions is published
+ * @then the status stream of a transaction contains only its statuses
+ * @and the stream is completed on the final status
+ */
+TEST_F(CommandServiceTest, getStatusStreamFromBatch) {
+  auto hash = shared_model::crypto::Hash("a");
+  auto other_hash = shared_model::crypto::Hash("b");
+  EXPECT_CALL(*tx_presence_cache_,
+              check(Matcher<const shared_model::crypto::Hash &>(_)))
+      .WillOnce(Return(iroha::ametsuchi::TxCacheStatusType{
+          iroha::ametsuchi::tx_cache_status_responses::Missing{hash}}));
+  auto batch = std::make_shared<const iroha::torii::StatusBus::Batch>(
+      iroha::torii::StatusBus::Batch{
+          tx_status_factory_->makeStatefulValid(other_hash),
+          tx_status_factory_->makeStatefulValid(hash),
+          tx_status_factory_->makeCommitted(hash)});
+  // the first call is made by the cache subscription of the service
+  EXPECT_CALL(*status_bus_, batches())
+      .WillOnce(Return(
+          rxcpp::observable<>::empty<iroha::torii::StatusBus::BatchPtr>()))
+      .WillOnce(Return(rxcpp::observable<>::just(batch)));
+
+  initCommandService();
+  // not received, stateful valid and committed statuses
+  auto wrapper = framework::test_subscriber::make_test_subscriber<
+      framework::test_subscriber::CallExact>(
+      command_service_->getStatusStream(hash), 3);
+  wrapper.subscribe([&hash](const auto &tx_response) {
+    ASSERT_EQ(hash, tx_response->transactionHash());
+  });
+  ASSERT_TRUE(wrapper.validate());
+}
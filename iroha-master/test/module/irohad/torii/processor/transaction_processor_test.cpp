@@ -46,6 +46,8 @@ class TransactionProcessorTest : public ::testing::Test {
 
     EXPECT_CALL(*pcs, onVerifiedProposal())
         .WillRepeatedly(Return(verified_prop_notifier.get_observable()));
+    EXPECT_CALL(*pcs, onExpiredBatches())
+        .WillRepeatedly(Return(ordering_expired_notifier.get_observable()));
 
     EXPECT_CALL(*mst, onStateUpdateImpl())
         .WillRepeatedly(Return(mst_update_notifier.get_observable()));
@@ -112,6 +114,19 @@ class TransactionProcessorTest : public ::testing::Test {
       std::shared_ptr<shared_model::interface::TransactionResponse>,
       shared_model::crypto::Hash::Hasher>;
 
+  /**
+   * Save statuses of published batches to status map and count them
+   */
+  void saveStatuses() {
+    EXPECT_CALL(*status_bus, publishBatch(_))
+        .WillRepeatedly(testing::Invoke([this](const auto &statuses) {
+          for (const auto &response : statuses) {
+            status_map[response->transactionHash()] = response;
+          }
+          published_statuses += statuses.size();
+        }));
+  }
+
   /**
    * Checks if all transactions have corresponding status
    * @param transactions transactions to check status
@@ -131,6 +146,7 @@ class TransactionProcessorTest : public ::testing::Test {
       mst_update_notifier;
   rxcpp::subjects::subject<iroha::DataType> mst_prepared_notifier;
   rxcpp::subjects::subject<iroha::DataType> mst_expired_notifier;
+  rxcpp::subjects::subject<iroha::DataType> ordering_expired_notifier;
   rxcpp::subjects::subject<
       std::shared_ptr<const shared_model::interface::Block>>
       commit_notifier;
@@ -143,6 +159,7 @@ class TransactionProcessorTest : public ::testing::Test {
   std::shared_ptr<MockMstProcessor> mst;
 
   StatusMapType status_map;
+  size_t published_statuses = 0;
   std::shared_ptr<shared_model::interface::TxStatusFactory> status_factory =
       std::make_shared<shared_model::proto::ProtoTxStatusFactory>();
 
@@ -166,11 +183,7 @@ TEST_F(TransactionProcessorTest, TransactionProcessorOnProposalTest) {
     txs.push_back(tx);
   }
 
-  EXPECT_CALL(*status_bus, publish(_))
-      .Times(proposal_size)
-      .WillRepeatedly(testing::Invoke([this](auto response) {
-        status_map[response->transactionHash()] = response;
-      }));
+  saveStatuses();
 
   EXPECT_CALL(*mst, propagateBatchImpl(_)).Times(0);
   EXPECT_CALL(*pcs, propagate_batch(_)).Times(txs.size());
@@ -184,6 +197,7 @@ TEST_F(TransactionProcessorTest, TransactionProcessorOnProposalTest) {
   auto proposal = std::make_shared<shared_model::proto::Proposal>(
       TestProposalBuilder().transactions(txs).build());
 
+  ASSERT_EQ(proposal_size, published_statuses);
   SCOPED_TRACE("Enough signatures collected status verification");
   validateStatuses<shared_model::interface::EnoughSignaturesCollectedResponse>(
       txs);
@@ -202,11 +216,7 @@ TEST_F(TransactionProcessorTest, TransactionProcessorOnProposalBatchTest) {
   auto transactions =
       framework::batch::createValidBatch(proposal_size)->transactions();
 
-  EXPECT_CALL(*status_bus, publish(_))
-      .Times(proposal_size)
-      .WillRepeatedly(testing::Invoke([this](auto response) {
-        status_map[response->transactionHash()] = response;
-      }));
+  saveStatuses();
 
   auto transaction_sequence_result = shared_model::interface::
       TransactionSequenceFactory::createTransactionSequence(
@@ -238,6 +248,7 @@ TEST_F(TransactionProcessorTest, TransactionProcessorOnProposalBatchTest) {
   auto proposal = std::make_shared<shared_model::proto::Proposal>(
       TestProposalBuilder().transactions(proto_transactions).build());
 
+  ASSERT_EQ(proposal_size, published_statuses);
   SCOPED_TRACE("Enough signatures collected status verification");
   validateStatuses<shared_model::interface::EnoughSignaturesCollectedResponse>(
       proto_transactions);
@@ -256,11 +267,7 @@ TEST_F(TransactionProcessorTest, TransactionProcessorVerifiedProposalTest) {
     txs.push_back(tx);
   }
 
-  EXPECT_CALL(*status_bus, publish(_))
-      .Times(txs.size() * 2)
-      .WillRepeatedly(testing::Invoke([this](auto response) {
-        status_map[response->transactionHash()] = response;
-      }));
+  saveStatuses();
 
   EXPECT_CALL(*mst, propagateBatchImpl(_)).Times(0);
   EXPECT_CALL(*pcs, propagate_batch(_)).Times(txs.size());
@@ -282,6 +289,7 @@ TEST_F(TransactionProcessorTest, TransactionProcessorVerifiedProposalTest) {
       simulator::VerifiedProposalCreatorEvent{
           validation_result, round, ledger_state});
 
+  ASSERT_EQ(txs.size() * 2, published_statuses);
   SCOPED_TRACE("Stateful Valid status verification");
   validateStatuses<shared_model::interface::StatefulValidTxResponse>(txs);
 }
@@ -300,11 +308,7 @@ TEST_F(TransactionProcessorTest, TransactionProcessorOnCommitTest) {
     txs.push_back(tx);
   }
 
-  EXPECT_CALL(*status_bus, publish(_))
-      .Times(txs.size() * 3)
-      .WillRepeatedly(testing::Invoke([this](auto response) {
-        status_map[response->transactionHash()] = response;
-      }));
+  saveStatuses();
 
   EXPECT_CALL(*mst, propagateBatchImpl(_)).Times(0);
   EXPECT_CALL(*pcs, propagate_batch(_)).Times(txs.size());
@@ -332,6 +336,7 @@ TEST_F(TransactionProcessorTest, TransactionProcessorOnCommitTest) {
   commit_notifier.get_subscriber().on_next(
       std::shared_ptr<shared_model::interface::Block>(clone(block)));
 
+  ASSERT_EQ(txs.size() * 3, published_statuses);
   SCOPED_TRACE("Committed status verification");
   validateStatuses<shared_model::interface::CommittedTxResponse>(txs);
 }
@@ -369,11 +374,7 @@ TEST_F(TransactionProcessorTest, TransactionProcessorInvalidTxsTest) {
   // Plus all transactions from block will
   // be committed and corresponding status will be sent
   // Rejected statuses will be published for invalid transactions
-  EXPECT_CALL(*status_bus, publish(_))
-      .Times(proposal_size + block_size + invalid_txs.size())
-      .WillRepeatedly(testing::Invoke([this](auto response) {
-        status_map[response->transactionHash()] = response;
-      }));
+  saveStatuses();
 
   auto proposal = std::make_shared<shared_model::proto::Proposal>(
       TestProposalBuilder()
@@ -424,6 +425,8 @@ TEST_F(TransactionProcessorTest, TransactionProcessorInvalidTxsTest) {
     // check that all transactions from block will be committed
     validateStatuses<shared_model::interface::CommittedTxResponse>(block_txs);
   }
+  ASSERT_EQ(proposal_size + block_size + invalid_txs.size(),
+            published_statuses);
 }
 
 /**
@@ -476,13 +479,39 @@ TEST_F(TransactionProcessorTest, MultisigExpired) {
                     shared_model::crypto::DefaultCryptoAlgorithmType::
                         generateKeypair())
                 .finish());
-  EXPECT_CALL(*status_bus, publish(_))
-      .WillRepeatedly(testing::Invoke([](auto response) {
-        ASSERT_NO_THROW(
-            boost::get<const shared_model::interface::MstExpiredResponse &>(
-                response->get()));
+  EXPECT_CALL(*status_bus, publishBatch(_))
+      .WillRepeatedly(testing::Invoke([](const auto &statuses) {
+        for (const auto &response : statuses) {
+          ASSERT_NO_THROW(
+              boost::get<const shared_model::interface::MstExpiredResponse &>(
+                  response->get()));
+        }
       }));
   tp->batchHandle(framework::batch::createBatchFromSingleTransaction(tx));
   mst_expired_notifier.get_subscriber().on_next(
       framework::batch::createBatchFromSingleTransaction(tx));
 }
+
+/**
+ * @given transaction processor
+ * @when ordering gate drops an expired batch
+ * @then its transactions get STATELESS_VALIDATION_FAILED status
+ */
+TEST_F(TransactionProcessorTest, OrderingExpired) {
+  std::shared_ptr<shared_model::interface::Transaction> tx =
+      clone(base_tx()
+                .build()
+                .signAndAddSignature(
+                    shared_model::crypto::DefaultCryptoAlgorithmType::
+                        generateKeypair())
+                .finish());
+  EXPECT_CALL(*status_bus, publishBatch(_))
+      .WillOnce(testing::Invoke([](const auto &statuses) {
+        ASSERT_EQ(1, statuses.size());
+        ASSERT_NO_THROW(boost::get<const shared_model::interface::
+                                       StatelessFailedTxResponse &>(
+            statuses.front()->get()));
+      }));
+  ordering_expired_notifier.get_subscriber().on_next(
+      framework::batch::createBatchFromSingleTransaction(tx));
+}
@@ -24,7 +24,9 @@ namespace iroha {
     class MockStatusBus : public StatusBus {
      public:
       MOCK_METHOD1(publish, void(StatusBus::Objects));
+      MOCK_METHOD1(publishBatch, void(StatusBus::Batch));
       MOCK_METHOD0(statuses, rxcpp::observable<StatusBus::Objects>());
+      MOCK_METHOD0(batches, rxcpp::observable<StatusBus::BatchPtr>());
     };
 
     class MockCommandService : public iroha::torii::CommandService {
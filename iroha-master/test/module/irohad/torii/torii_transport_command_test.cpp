@@ -26,6 +26,7 @@
 #include "module/shared_model/interface/mock_transaction_batch_factory.hpp"
 #include "module/shared_model/validators/validators.hpp"
 #include "module/vendor/grpc_mocks.hpp"
+#include "torii/impl/admission_control.hpp"
 #include "torii/impl/status_bus_impl.hpp"
 #include "validators/protobuf/proto_transaction_validator.hpp"
 
@@ -75,12 +76,10 @@ class CommandServiceTransportGrpcTest : public testing::Test {
     batch_factory = std::make_shared<MockTransactionBatchFactory>();
   }
 
-  void SetUp() override {
-    init();
-
-    status_bus = std::make_shared<MockStatusBus>();
-    command_service = std::make_shared<MockCommandService>();
-
+  /**
+   * Create the transport with the given admission limits
+   */
+  void initTransport(AdmissionLimits limits) {
     transport_grpc = std::make_shared<CommandServiceTransportGrpc>(
         command_service,
         status_bus,
@@ -88,11 +87,22 @@ class CommandServiceTransportGrpcTest : public testing::Test {
         transaction_factory,
         batch_parser,
         batch_factory,
+        std::make_shared<AdmissionControl>(limits,
+                                           getTestLogger("AdmissionControl")),
         rxcpp::observable<>::iterate(gate_objects),
         gate_objects.size(),
         getTestLogger("CommandServiceTransportGrpc"));
   }
 
+  void SetUp() override {
+    init();
+
+    status_bus = std::make_shared<MockStatusBus>();
+    command_service = std::make_shared<MockCommandService>();
+
+    initTransport(AdmissionLimits{});
+  }
+
   std::shared_ptr<MockStatusBus> status_bus;
   const MockTxValidator *tx_validator;
   const MockProtoTxValidator *proto_tx_validator;
@@ -170,6 +180,41 @@ TEST_F(CommandServiceTransportGrpcTest, ListTorii) {
   transport_grpc->ListTorii(&context, &request, &response);
 }
 
+/**
+ * @given torii service with a client rate limit of 1 transaction
+ * @when calling ListTorii twice
+ * @then the first request is served
+ * @and the second one is rejected with resource exhausted status
+ */
+TEST_F(CommandServiceTransportGrpcTest, ListToriiOverloaded) {
+  initTransport(AdmissionLimits{0, 1});
+  grpc::ServerContext context;
+  google::protobuf::Empty response;
+
+  iroha::protocol::TxList request;
+  for (size_t i = 0; i < kTimes; ++i) {
+    request.add_transactions();
+  }
+
+  EXPECT_CALL(*proto_tx_validator, validate(_))
+      .Times(kTimes * 2)
+      .WillRepeatedly(Return(shared_model::validation::Answer{}));
+  EXPECT_CALL(*tx_validator, validate(_))
+      .Times(kTimes * 2)
+      .WillRepeatedly(Return(shared_model::validation::Answer{}));
+  EXPECT_CALL(
+      *batch_factory,
+      createTransactionBatch(
+          A<const shared_model::interface::types::SharedTxsCollectionType &>()))
+      .Times(kTimes);
+
+  EXPECT_CALL(*command_service, handleTransactionBatch(_)).Times(kTimes);
+  ASSERT_TRUE(transport_grpc->ListTorii(&context, &request, &response).ok());
+  ASSERT_EQ(grpc::StatusCode::RESOURCE_EXHAUSTED,
+            transport_grpc->ListTorii(&context, &request, &response)
+                .error_code());
+}
+
 /**
  * @given torii service and number of invalid transactions
  * @when calling ListTorii
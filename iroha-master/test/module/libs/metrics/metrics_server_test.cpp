@@ -0,0 +1,82 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "metrics/metrics_server.hpp"
+
+#include <array>
+
+#include <gtest/gtest.h>
+#include <boost/asio/connect.hpp>
+#include <boost/asio/read.hpp>
+#include <boost/asio/write.hpp>
+#include "framework/test_logger.hpp"
+#include "metrics/metrics.hpp"
+
+using namespace iroha::metrics;
+using boost::asio::ip::tcp;
+
+class MetricsServerTest : public ::testing::Test {
+ public:
+  void SetUp() override {
+    registry.counter("requests_total", "Requests").increment(3);
+    server = std::make_unique<MetricsServer>(registry,
+                                             getTestLogger("MetricsServer"));
+  }
+
+  /**
+   * Send a request to the server and read the response until the server
+   * closes the connection
+   * @param port - port of the server
+   * @return the response
+   */
+  std::string get(uint16_t port) {
+    boost::asio::io_service io_service;
+    tcp::socket socket(io_service);
+    socket.connect(
+        tcp::endpoint(boost::asio::ip::address::from_string("127.0.0.1"),
+                      port));
+    std::string request = "GET /metrics HTTP/1.1\r\nHost: localhost\r\n\r\n";
+    boost::asio::write(socket, boost::asio::buffer(request));
+
+    std::string response;
+    boost::system::error_code error;
+    std::array<char, 1024> buffer;
+    while (not error) {
+      auto size = socket.read_some(boost::asio::buffer(buffer), error);
+      response.append(buffer.data(), size);
+    }
+    return response;
+  }
+
+  Registry registry;
+  std::unique_ptr<MetricsServer> server;
+};
+
+/**
+ * @given metrics server listening on a free port of the loopback address
+ * @when an HTTP request is sent to it
+ * @then the response contains the metrics of the registry
+ */
+TEST_F(MetricsServerTest, ServesMetrics) {
+  auto port =
+      iroha::expected::resultToOptionalValue(server->run("127.0.0.1", 0));
+  ASSERT_TRUE(port);
+
+  auto response = get(*port);
+  EXPECT_EQ(0u, response.find("HTTP/1.1 200 OK\r\n")) << response;
+  EXPECT_NE(std::string::npos, response.find("\r\n\r\n# HELP requests_total"))
+      << response;
+  EXPECT_NE(std::string::npos, response.find("\nrequests_total 3\n"))
+      << response;
+}
+
+/**
+ * @given metrics server
+ * @when it is started with a malformed address
+ * @then an error is returned
+ */
+TEST_F(MetricsServerTest, WrongAddress) {
+  ASSERT_TRUE(iroha::expected::hasError(server->run("localhost:9100", 0)));
+}
@@ -0,0 +1,80 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "metrics/metrics.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace iroha::metrics;
+
+/**
+ * @given registry
+ * @when a counter is requested twice by the same name
+ * @then the same counter is returned
+ */
+TEST(MetricsTest, CounterIsRegisteredOnce) {
+  Registry registry;
+  registry.counter("requests_total", "Requests").increment();
+  registry.counter("requests_total", "Requests").increment(2);
+
+  ASSERT_EQ(3u, registry.counter("requests_total", "Requests").value());
+}
+
+/**
+ * @given histogram with bounds 1 and 10
+ * @when values 0.5, 1, 5 and 100 are observed
+ * @then each bucket holds the values up to its bound, and the sum is kept
+ */
+TEST(MetricsTest, HistogramBuckets) {
+  Histogram histogram({1, 10});
+  for (auto value : {0.5, 1., 5., 100.}) {
+    histogram.observe(value);
+  }
+
+  ASSERT_EQ((std::vector<uint64_t>{2, 1, 1}), histogram.bucketCounts());
+  ASSERT_DOUBLE_EQ(106.5, histogram.sum());
+}
+
+/**
+ * @given registry with a gauge and a histogram
+ * @when it is serialized
+ * @then the output is in Prometheus text format with cumulative buckets
+ */
+TEST(MetricsTest, Serialize) {
+  Registry registry;
+  registry.gauge("queue_size", "Queue size").set(-2);
+  auto &histogram = registry.histogram("duration", "Duration", {1, 10});
+  histogram.observe(0.5);
+  histogram.observe(5);
+
+  ASSERT_EQ(
+      "# HELP duration Duration\n"
+      "# TYPE duration histogram\n"
+      "duration_bucket{le=\"1\"} 1\n"
+      "duration_bucket{le=\"10\"} 2\n"
+      "duration_bucket{le=\"+Inf\"} 2\n"
+      "duration_sum 5.5\n"
+      "duration_count 2\n"
+      "# HELP queue_size Queue size\n"
+      "# TYPE queue_size gauge\n"
+      "queue_size -2\n",
+      registry.serialize());
+}
+
+/**
+ * @given histogram
+ * @when a value with more significant digits than the default stream
+ * precision is observed
+ * @then the sum is serialized without rounding
+ */
+TEST(MetricsTest, SerializeExactValues) {
+  Registry registry;
+  registry.histogram("latency_seconds", "Latency", {1}).observe(1234567.25);
+
+  auto serialized = registry.serialize();
+  ASSERT_NE(std::string::npos,
+            serialized.find("latency_seconds_sum 1234567.25\n"))
+      << serialized;
+}
@@ -0,0 +1,81 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "tracing/trace_dumper.hpp"
+
+#include <fstream>
+#include <sstream>
+#include <thread>
+
+#include <gtest/gtest.h>
+#include <boost/filesystem.hpp>
+#include "framework/test_logger.hpp"
+
+using namespace iroha::tracing;
+
+class TraceDumperTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    tracer_.enable(10);
+  }
+
+  void TearDown() override {
+    boost::filesystem::remove(path_);
+  }
+
+  /// @return contents of the trace file
+  std::string trace() const {
+    std::ifstream file(path_);
+    std::stringstream contents;
+    contents << file.rdbuf();
+    return contents.str();
+  }
+
+  Tracer tracer_;
+  const std::string path_ =
+      (boost::filesystem::temp_directory_path()
+       / boost::filesystem::unique_path())
+          .string();
+};
+
+/**
+ * @given dumper with a short interval
+ * @when an event is recorded and the dumper keeps running
+ * @then the event is written to the file before the dumper is destroyed
+ */
+TEST_F(TraceDumperTest, PeriodicDump) {
+  TraceDumper dumper(tracer_,
+                     path_,
+                     std::chrono::milliseconds(10),
+                     getTestLogger("TraceDumper"));
+  tracer_.record("stage", "periodic");
+
+  auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+  while (trace().find("periodic") == std::string::npos
+         and std::chrono::steady_clock::now() < deadline) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+  ASSERT_NE(std::string::npos, trace().find("periodic"));
+}
+
+/**
+ * @given dumper without periodic dumps
+ * @when an event is recorded and the dumper is destroyed
+ * @then the file is written only on destruction
+ */
+TEST_F(TraceDumperTest, FinalDump) {
+  {
+    TraceDumper dumper(tracer_,
+                       path_,
+                       std::chrono::milliseconds::zero(),
+                       getTestLogger("TraceDumper"));
+    tracer_.record("stage", "final");
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    ASSERT_FALSE(boost::filesystem::exists(path_));
+  }
+
+  ASSERT_NE(std::string::npos, trace().find("final"));
+  ASSERT_FALSE(boost::filesystem::exists(path_ + ".tmp"));
+}
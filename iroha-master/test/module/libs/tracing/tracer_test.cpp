@@ -0,0 +1,47 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "tracing/tracer.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace iroha::tracing;
+
+/// @return ids of the events
+static std::vector<std::string> ids(const std::vector<TraceEvent> &events) {
+  std::vector<std::string> ids;
+  for (const auto &event : events) {
+    ids.push_back(event.id);
+  }
+  return ids;
+}
+
+/**
+ * @given tracer which is not enabled
+ * @when an event is recorded
+ * @then it is not kept
+ */
+TEST(TracerTest, DisabledTracerKeepsNothing) {
+  Tracer tracer;
+  tracer.record("stage", "id");
+
+  ASSERT_FALSE(tracer.enabled());
+  ASSERT_TRUE(tracer.events().empty());
+}
+
+/**
+ * @given tracer with capacity 2
+ * @when 3 events are recorded
+ * @then the 2 latest events are kept in the recording order
+ */
+TEST(TracerTest, OldestEventIsOverwritten) {
+  Tracer tracer;
+  tracer.enable(2);
+  for (auto id : {"1", "2", "3"}) {
+    tracer.record("stage", id);
+  }
+
+  ASSERT_EQ((std::vector<std::string>{"2", "3"}), ids(tracer.events()));
+}
@@ -5,6 +5,8 @@
 
 #include <gtest/gtest.h>
 
+#include <boost/range/size.hpp>
+#include "backend/protobuf/block.hpp"
 #include "backend/protobuf/proto_block_factory.hpp"
 #include "datetime/time.hpp"
 #include "module/shared_model/validators/validators.hpp"
@@ -50,3 +52,32 @@ TEST_F(ProtoBlockFactoryTest, UnsafeBlockCreation) {
   ASSERT_EQ(block->prevHash().hex(), prev_hash.hex());
   ASSERT_EQ(block->transactions(), txs);
 }
+
+/**
+ * @given proto block allocated on an arena
+ * @when block is created from it using createBlock function
+ * @then the block borrows the proto block instead of copying it
+ * @and the block remains valid after the other owners release the arena
+ */
+TEST_F(ProtoBlockFactoryTest, ArenaBlockCreation) {
+  auto arena = std::make_shared<google::protobuf::Arena>();
+  auto *proto_block =
+      google::protobuf::Arena::CreateMessage<iroha::protocol::Block>(
+          arena.get());
+  auto *payload = proto_block->mutable_block_v1()->mutable_payload();
+  payload->set_height(2);
+  payload->set_created_time(iroha::time::now());
+  payload->add_transactions();
+  auto blob = proto_block->block_v1().SerializeAsString();
+
+  auto result = factory->createBlock(arena, *proto_block);
+  auto block = iroha::expected::resultToOptionalValue(std::move(result));
+  ASSERT_TRUE(block);
+  ASSERT_EQ(&static_cast<const proto::Block &>(**block).getTransport(),
+            &proto_block->block_v1());
+
+  arena.reset();
+  ASSERT_EQ((*block)->height(), 2);
+  ASSERT_EQ(boost::size((*block)->transactions()), 1);
+  ASSERT_EQ((*block)->blob().blob(), crypto::Blob(blob).blob());
+}